@@ -0,0 +1,494 @@
+#ifndef Magnum_AbstractAsyncResourceLoader_h
+#define Magnum_AbstractAsyncResourceLoader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::AbstractAsyncResourceLoader
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "AbstractResourceLoader.h"
+
+namespace Magnum {
+
+/**
+@brief Base for asynchronous resource loaders
+
+Loads the resources on a pool of worker threads, so file I/O and decoding
+don't stall the thread which is calling ResourceManager::get() (usually the
+rendering thread).
+
+@section AbstractAsyncResourceLoader-usage Usage and subclassing
+
+Subclassing is done by implementing doLoad(), which is called from worker
+threads. The implementation must not access ResourceManager nor any OpenGL
+state, it should only load the data and then pass them to complete() or call
+completeNotFound() if the resource was not found. These functions only put
+the result into thread-safe completion queue. The subclass destructor must
+call stop(), so the worker threads don't call doLoad() of already destroyed
+subclass.
+
+The resource requested through ResourceManager::get() stays in
+@ref ResourceState "ResourceState::Loading" state (or
+@ref ResourceState "ResourceState::LoadingFallback", if fallback is set) until
+the finished data are passed to the manager by calling update() from the
+thread which owns the manager, usually once per frame:
+@code
+class MeshDataResourceLoader: public AbstractAsyncResourceLoader<Trade::MeshData3D> {
+    public:
+        ~MeshDataResourceLoader() { stop(); }
+
+    private:
+        void doLoad(ResourceKey key) override {
+            // Read and decode the file...
+
+            if(!found) completeNotFound(key);
+            else complete(key, data, ResourceDataState::Final, ResourcePolicy::Resident);
+        }
+};
+
+MyResourceManager manager;
+manager.setLoader(new MeshDataResourceLoader);
+
+// Each frame
+manager.loader<Trade::MeshData3D>()->update();
+@endcode
+
+@section AbstractAsyncResourceLoader-priority Prefetching and priorities
+
+Resources requested through ResourceManager::get() are loaded with zero
+priority in order of requests. Resources which will be needed later can be
+requested upfront with prefetch(), optionally with a priority. Resources
+with higher priority are loaded first, so e.g. for level streaming the
+priority could be negative distance from the camera:
+@code
+for(const Chunk& chunk: visibleChunks)
+    loader->prefetch(chunk.meshKey, -(chunk.center - cameraPosition).length());
+@endcode
+
+Priority of already queued resources can be changed with setPriority() and
+resources which are not needed anymore can be removed from the queue with
+cancel().
+
+If the loader is constructed with zero threads (and always when targeting
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten"), no threads are spawned and the
+loading is done on the calling thread in update().
+
+@attention The subclass is destroyed before the destructor of this class is
+    called, so the worker threads must be stopped by calling stop() in the
+    subclass destructor. The destructor of this class asserts that it was
+    done and stops the threads itself if not, but jobs running at that point
+    might already call doLoad() of the destroyed subclass.
+*/
+template<class T> class AbstractAsyncResourceLoader: public AbstractResourceLoader<T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Count of worker threads. If set to `0`, the
+         *      resources are loaded on the calling thread in update().
+         *
+         * The threads are spawned immediately.
+         * @see defaultThreadCount()
+         */
+        explicit AbstractAsyncResourceLoader(UnsignedInt threadCount = defaultThreadCount());
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that stop() was called, calls it if not. Deletes data
+         * which were not yet passed to the manager.
+         */
+        ~AbstractAsyncResourceLoader();
+
+        /**
+         * @brief Default count of worker threads
+         *
+         * Count of hardware threads, at least `1`. Returns `0` when targeting
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        static UnsignedInt defaultThreadCount();
+
+        /** @brief Count of worker threads */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Count of pending resources
+         *
+         * Count of resources requested through load() which were not yet
+         * passed to the manager in update().
+         */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Request resource to be loaded
+         *
+         * Sets resource state to @ref ResourceState "ResourceState::Loading"
+         * and puts the key into job queue with zero priority.
+         * @see prefetch()
+         */
+        void load(ResourceKey key) override;
+
+        /**
+         * @brief Request resource to be loaded with given priority
+         *
+         * If the resource is not yet loaded nor loading, sets its state to
+         * @ref ResourceState "ResourceState::Loading" and puts the key into
+         * job queue. Resources with higher priority are loaded first,
+         * resources with the same priority are loaded in order of requests.
+         * If the resource is already queued, only changes its priority.
+         * Unlike ResourceManager::get() it doesn't add any reference to the
+         * resource.
+         * @see setPriority(), cancel()
+         */
+        void prefetch(ResourceKey key, Float priority = 0.0f);
+
+        /**
+         * @brief Change priority of queued resource
+         * @return `False` if the resource is not in the queue (i.e. it is
+         *      already loading or loaded), `true` otherwise.
+         */
+        bool setPriority(ResourceKey key, Float priority);
+
+        /**
+         * @brief Cancel loading of given resource
+         * @return `False` if the resource is currently being loaded or is
+         *      not requested at all, `true` otherwise.
+         *
+         * Removes the resource from the queue or discards already loaded
+         * data which were not yet passed to the manager in update(). The
+         * resource is then put back into @ref ResourceState "ResourceState::NotLoaded"
+         * state, call prefetch() to request it again.
+         */
+        bool cancel(ResourceKey key);
+
+        /**
+         * @brief Pass finished resources to the manager
+         * @return Count of resources passed to the manager
+         *
+         * Must be called from the thread which owns the manager. If the
+         * loader has no worker threads, loads all queued resources first.
+         */
+        std::size_t update();
+
+        /**
+         * @brief Wait for all queued resources to be loaded
+         *
+         * Blocks until the job queue is empty and no worker is loading
+         * anything. The finished resources are not passed to the manager,
+         * call update() afterwards. If the loader has no worker threads,
+         * loads all queued resources on calling thread.
+         */
+        void wait();
+
+    protected:
+        /**
+         * @brief Complete loading of given resource
+         *
+         * Can be called from any thread, the data are passed to the manager
+         * in next call to update(). See AbstractResourceLoader::set() for
+         * allowed values of @p state and @p policy.
+         */
+        void complete(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+
+        /**
+         * @brief Complete loading of not found resource
+         *
+         * Can be called from any thread, the resource is marked as not found
+         * in next call to update().
+         */
+        inline void completeNotFound(ResourceKey key) {
+            complete(key, nullptr, ResourceDataState::NotFound, ResourcePolicy::Resident);
+        }
+
+        /**
+         * @brief Stop the worker threads
+         *
+         * Waits for running jobs and discards queued jobs, threads blocked
+         * in wait() are woken up. Must be called in the subclass
+         * destructor, see
+         * @ref AbstractAsyncResourceLoader-usage "class documentation" for
+         * more information. Calling it more than once is allowed, no
+         * resources are loaded afterwards.
+         */
+        void stop();
+
+    private:
+        struct Completed {
+            inline Completed(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy): key(key), data(data), state(state), policy(policy) {}
+
+            ResourceKey key;
+            T* data;
+            ResourceDataState state;
+            ResourcePolicy policy;
+        };
+
+        /**
+         * @brief Implementation for load()
+         *
+         * Called from worker thread. The implementation must pass the result
+         * to complete() or completeNotFound().
+         */
+        virtual void doLoad(ResourceKey key) = 0;
+
+        void runQueued();
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void worker();
+        #endif
+
+        /* Sorted by descending priority, equal keys are kept in insertion
+           order */
+        typedef std::multimap<Float, ResourceKey, std::greater<Float>> Queue;
+
+        void enqueue(ResourceKey key, Float priority);
+        ResourceKey dequeue();
+
+        mutable std::mutex _mutex;
+        std::condition_variable _jobAvailable, _jobsDone;
+        Queue _jobs;
+        std::unordered_map<ResourceKey, typename Queue::iterator, Implementation::ResourceKeyHash> _queued;
+        std::vector<Completed> _completed;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::vector<std::thread> _threads;
+        #endif
+        std::size_t _running;
+        bool _quit;
+};
+
+template<class T> AbstractAsyncResourceLoader<T>::AbstractAsyncResourceLoader(UnsignedInt threadCount): _running(0), _quit(false) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _threads.reserve(threadCount);
+    for(UnsignedInt i = 0; i != threadCount; ++i)
+        _threads.emplace_back(&AbstractAsyncResourceLoader<T>::worker, this);
+    #else
+    static_cast<void>(threadCount);
+    #endif
+}
+
+template<class T> AbstractAsyncResourceLoader<T>::~AbstractAsyncResourceLoader() {
+    /* Last line of defence, so the threads don't outlive the loader if the
+       assertion is disabled */
+    const bool stopped = _quit;
+    stop();
+
+    for(const Completed& completed: _completed) delete completed.data;
+
+    CORRADE_ASSERT(stopped,
+        "AbstractAsyncResourceLoader: stop() must be called in subclass destructor", );
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+        _jobs.clear();
+        _queued.clear();
+    }
+
+    /* Wake up wait(), no job might be running which would do that */
+    _jobsDone.notify_all();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _jobAvailable.notify_all();
+    for(std::thread& thread: _threads)
+        if(thread.joinable()) thread.join();
+    #endif
+}
+
+template<class T> UnsignedInt AbstractAsyncResourceLoader<T>::defaultThreadCount() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return std::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    return 0;
+    #endif
+}
+
+template<class T> UnsignedInt AbstractAsyncResourceLoader<T>::threadCount() const {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return _threads.size();
+    #else
+    return 0;
+    #endif
+}
+
+template<class T> std::size_t AbstractAsyncResourceLoader<T>::pendingCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _jobs.size() + _running + _completed.size();
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::load(ResourceKey key) {
+    AbstractResourceLoader<T>::load(key);
+    enqueue(key, 0.0f);
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::prefetch(ResourceKey key, const Float priority) {
+    if(setPriority(key, priority)) return;
+
+    /* Already loading or loaded */
+    const ResourceState state = this->state(key);
+    if(state != ResourceState::NotLoaded && state != ResourceState::NotLoadedFallback) return;
+
+    AbstractResourceLoader<T>::load(key);
+    enqueue(key, priority);
+}
+
+template<class T> bool AbstractAsyncResourceLoader<T>::setPriority(ResourceKey key, const Float priority) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _queued.find(key);
+    if(found == _queued.end()) return false;
+
+    _jobs.erase(found->second);
+    found->second = _jobs.insert(std::make_pair(priority, key));
+    return true;
+}
+
+template<class T> bool AbstractAsyncResourceLoader<T>::cancel(ResourceKey key) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto found = _queued.find(key);
+
+        /* Remove from the queue */
+        if(found != _queued.end()) {
+            _jobs.erase(found->second);
+            _queued.erase(found);
+
+        /* Or discard the loaded data */
+        } else {
+            auto completed = std::find_if(_completed.begin(), _completed.end(), [key](const Completed& c) { return c.key == key; });
+            if(completed == _completed.end()) return false;
+            delete completed->data;
+            _completed.erase(completed);
+        }
+    }
+
+    this->setCancelled(key);
+    return true;
+}
+
+template<class T> std::size_t AbstractAsyncResourceLoader<T>::update() {
+    if(!threadCount()) runQueued();
+
+    /* Take the completed resources out of the queue so the workers don't
+       need to wait for the manager */
+    std::vector<Completed> completed;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::swap(completed, _completed);
+    }
+
+    for(const Completed& c: completed) {
+        if(c.state == ResourceDataState::NotFound) this->setNotFound(c.key);
+        else this->set(c.key, c.data, c.state, c.policy);
+    }
+
+    return completed.size();
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::wait() {
+    if(!threadCount()) {
+        runQueued();
+        return;
+    }
+
+    /* Nothing is loaded after stop(), don't wait for it */
+    std::unique_lock<std::mutex> lock(_mutex);
+    _jobsDone.wait(lock, [this]() { return (_quit || _jobs.empty()) && !_running; });
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::complete(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
+    CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound),
+        "AbstractAsyncResourceLoader::complete(): data should be null if and only if state is NotFound", );
+    CORRADE_ASSERT(state != ResourceDataState::Loading,
+        "AbstractAsyncResourceLoader::complete(): state cannot be Loading", );
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _completed.emplace_back(key, data, state, policy);
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::enqueue(ResourceKey key, const Float priority) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const typename Queue::iterator job = _jobs.insert(std::make_pair(priority, key));
+
+        /* If already queued, replace the previous request */
+        auto inserted = _queued.insert(std::make_pair(key, job));
+        if(!inserted.second) {
+            _jobs.erase(inserted.first->second);
+            inserted.first->second = job;
+        }
+    }
+
+    _jobAvailable.notify_one();
+}
+
+template<class T> ResourceKey AbstractAsyncResourceLoader<T>::dequeue() {
+    const ResourceKey key = _jobs.begin()->second;
+    _jobs.erase(_jobs.begin());
+    _queued.erase(key);
+    return key;
+}
+
+template<class T> void AbstractAsyncResourceLoader<T>::runQueued() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(!_quit && !_jobs.empty()) {
+        const ResourceKey key = dequeue();
+
+        lock.unlock();
+        doLoad(key);
+        lock.lock();
+    }
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+template<class T> void AbstractAsyncResourceLoader<T>::worker() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    for(;;) {
+        _jobAvailable.wait(lock, [this]() { return _quit || !_jobs.empty(); });
+        if(_quit) return;
+
+        const ResourceKey key = dequeue();
+        ++_running;
+
+        lock.unlock();
+        doLoad(key);
+        lock.lock();
+
+        if(!--_running && _jobs.empty()) _jobsDone.notify_all();
+    }
+}
+#endif
+
+}
+
+#endif
@@ -28,6 +28,7 @@
  * @brief Class Magnum::AbstractResourceLoader
  */
 
+#include <atomic>
 #include <string>
 
 #include "ResourceManager.h"
@@ -59,6 +60,11 @@ so ResourceManager is informed about loading state. Then, after your resources
 are loaded, call set() to pass them to ResourceManager or call setNotFound()
 to indicate that the resource was not found.
 
+ResourceManager::get() calls load() from the thread which requested the
+resource, so with the manager used from multiple threads load() may be
+called concurrently for different keys. The base implementation and the
+counters are thread-safe, the subclass implementation must be too.
+
 You can also implement name() to provide meaningful names for resource keys.
 
 Example implementation for synchronous mesh loader:
@@ -93,6 +99,8 @@ manager->setLoader(loader);
 // This will now automatically request the mesh from loader by calling load()
 Resource<Mesh> myMesh = manager->get<Mesh>("my-mesh");
 @endcode
+
+For loading on worker threads see AbstractAsyncResourceLoader.
 */
 template<class T> class AbstractResourceLoader {
     friend class Implementation::ResourceManagerData<T>;
@@ -180,11 +188,32 @@ template<class T> class AbstractResourceLoader {
             manager->set(key, nullptr, ResourceDataState::NotFound, ResourcePolicy::Resident);
         }
 
+        /**
+         * @brief State of given resource in the manager
+         *
+         * See ResourceManager::state() for more information.
+         */
+        inline ResourceState state(ResourceKey key) const {
+            return manager->state(key);
+        }
+
+        /**
+         * @brief Cancel loading of given resource
+         *
+         * If the resource is still in @ref ResourceState "ResourceState::Loading"
+         * state, it is put back to @ref ResourceState "ResourceState::NotLoaded"
+         * state (or removed from the manager, if nothing references it).
+         * Otherwise does nothing.
+         */
+        inline void setCancelled(ResourceKey key) {
+            manager->cancelLoading(key);
+        }
+
     private:
         Implementation::ResourceManagerData<T>* manager;
-        std::size_t _requestedCount;
-        std::size_t _loadedCount;
-        std::size_t _notFoundCount;
+        std::atomic<std::size_t> _requestedCount;
+        std::atomic<std::size_t> _loadedCount;
+        std::atomic<std::size_t> _notFoundCount;
 };
 
 template<class T> inline std::string AbstractResourceLoader<T>::name(ResourceKey) const { return {}; }
@@ -27,7 +27,7 @@
 namespace Magnum {
 
 template<UnsignedInt dimensions> void Image<dimensions>::setData(const typename DimensionTraits<Dimensions, GLsizei>::VectorType& size, Format format, Type type, GLvoid* data) {
-    delete[] _data;
+    if(data != _data) delete[] _data;
     _format = format;
     _type = type;
     _size = size;
@@ -85,7 +85,10 @@ template<UnsignedInt dimensions> class Image: public AbstractImage {
          * @param data              %Image data
          *
          * Deletes previous data and replaces them with new. Note that the
-         * data are not copied, but they are deleted on destruction.
+         * data are not copied, but they are deleted on destruction. If
+         * @p data is the same pointer as current data, they are not deleted,
+         * which allows changing image properties of data converted in
+         * place.
          */
         void setData(const typename DimensionTraits<Dimensions, Int>::VectorType& size, Format format, Type type, GLvoid* data);
 
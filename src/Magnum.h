@@ -394,6 +394,8 @@ template<class...> class ResourceManager;
 
 class Shader;
 
+template<class> class StridedArrayView;
+
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
 typedef Texture<1> Texture1D;
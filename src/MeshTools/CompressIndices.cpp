@@ -38,7 +38,7 @@ template<> inline constexpr Mesh::IndexType indexType<UnsignedByte>() { return M
 template<> inline constexpr Mesh::IndexType indexType<UnsignedShort>() { return Mesh::IndexType::UnsignedShort; }
 template<> inline constexpr Mesh::IndexType indexType<UnsignedInt>() { return Mesh::IndexType::UnsignedInt; }
 
-template<class T> inline std::tuple<std::size_t, Mesh::IndexType, char*> compress(const std::vector<UnsignedInt>& indices) {
+template<class T> inline std::tuple<std::size_t, Mesh::IndexType, char*> compress(StridedArrayView<const UnsignedInt> indices) {
     char* buffer = new char[indices.size()*sizeof(T)];
     for(std::size_t i = 0; i != indices.size(); ++i) {
         T index = static_cast<T>(indices[i]);
@@ -48,7 +48,7 @@ template<class T> inline std::tuple<std::size_t, Mesh::IndexType, char*> compres
     return std::make_tuple(indices.size(), indexType<T>(), buffer);
 }
 
-std::tuple<std::size_t, Mesh::IndexType, char*> compressIndicesInternal(const std::vector<UnsignedInt>& indices, UnsignedInt max) {
+std::tuple<std::size_t, Mesh::IndexType, char*> compressIndicesInternal(StridedArrayView<const UnsignedInt> indices, UnsignedInt max) {
     switch(Math::log(256, max)) {
         case 0:
             return compress<UnsignedByte>(indices);
@@ -65,11 +65,11 @@ std::tuple<std::size_t, Mesh::IndexType, char*> compressIndicesInternal(const st
 
 }
 
-std::tuple<std::size_t, Mesh::IndexType, char*> compressIndices(const std::vector<UnsignedInt>& indices) {
+std::tuple<std::size_t, Mesh::IndexType, char*> compressIndices(StridedArrayView<const UnsignedInt> indices) {
     return compressIndicesInternal(indices, *std::max_element(indices.begin(), indices.end()));
 }
 
-void compressIndices(Mesh* mesh, Buffer* buffer, Buffer::Usage usage, const std::vector<UnsignedInt>& indices) {
+void compressIndices(Mesh* mesh, Buffer* buffer, Buffer::Usage usage, StridedArrayView<const UnsignedInt> indices) {
     auto minmax = std::minmax_element(indices.begin(), indices.end());
 
     /** @todo Performance hint when range can be represented by smaller value? */
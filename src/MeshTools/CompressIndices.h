@@ -32,6 +32,7 @@
 
 #include "Buffer.h"
 #include "Mesh.h"
+#include "StridedArrayView.h"
 
 #include "magnumMeshToolsVisibility.h"
 
@@ -58,10 +59,15 @@ std::size_t dataSize = indexCount*Mesh::indexSize(indexType);
 delete[] data;
 @endcode
 
-See also compressIndices(Mesh*, Buffer*, Buffer::Usage, const std::vector<UnsignedInt>&),
+See also compressIndices(Mesh*, Buffer*, Buffer::Usage, StridedArrayView<const UnsignedInt>),
 which writes the compressed data directly into index buffer of given mesh.
 */
-std::tuple<std::size_t, Mesh::IndexType, char*> MAGNUM_MESHTOOLS_EXPORT compressIndices(const std::vector<UnsignedInt>& indices);
+std::tuple<std::size_t, Mesh::IndexType, char*> MAGNUM_MESHTOOLS_EXPORT compressIndices(StridedArrayView<const UnsignedInt> indices);
+
+/** @overload */
+inline std::tuple<std::size_t, Mesh::IndexType, char*> compressIndices(const std::vector<UnsignedInt>& indices) {
+    return compressIndices(StridedArrayView<const UnsignedInt>(indices));
+}
 
 /**
 @brief Compress vertex indices and write them to index buffer
@@ -70,14 +76,19 @@ std::tuple<std::size_t, Mesh::IndexType, char*> MAGNUM_MESHTOOLS_EXPORT compress
 @param usage    Index buffer usage
 @param indices  Index array
 
-The same as compressIndices(const std::vector<UnsignedInt>&), but this
+The same as compressIndices(StridedArrayView<const UnsignedInt>), but this
 function writes the output to given buffer, updates index count and specifies
 index buffer with proper index range in the mesh, so you don't have to call
 Mesh::setIndexCount() and Mesh::setIndexBuffer() on your own.
 
 @see MeshTools::interleave()
 */
-void MAGNUM_MESHTOOLS_EXPORT compressIndices(Mesh* mesh, Buffer* buffer, Buffer::Usage usage, const std::vector<UnsignedInt>& indices);
+void MAGNUM_MESHTOOLS_EXPORT compressIndices(Mesh* mesh, Buffer* buffer, Buffer::Usage usage, StridedArrayView<const UnsignedInt> indices);
+
+/** @overload */
+inline void compressIndices(Mesh* mesh, Buffer* buffer, Buffer::Usage usage, const std::vector<UnsignedInt>& indices) {
+    compressIndices(mesh, buffer, usage, StridedArrayView<const UnsignedInt>(indices));
+}
 
 }}
 
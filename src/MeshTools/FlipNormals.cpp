@@ -28,14 +28,14 @@
 
 namespace Magnum { namespace MeshTools {
 
-void flipFaceWinding(std::vector<UnsignedInt>& indices) {
+void flipFaceWinding(StridedArrayView<UnsignedInt> indices) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::flipNormals(): index count is not divisible by 3!", );
 
     for(std::size_t i = 0; i != indices.size(); i += 3)
         std::swap(indices[i+1], indices[i+2]);
 }
 
-void flipNormals(std::vector<Vector3>& normals) {
+void flipNormals(StridedArrayView<Vector3> normals) {
     for(Vector3& normal: normals)
         normal = -normal;
 }
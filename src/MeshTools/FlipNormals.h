@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "Magnum.h"
+#include "StridedArrayView.h"
 
 #include "magnumMeshToolsVisibility.h"
 
@@ -39,18 +40,28 @@ namespace Magnum { namespace MeshTools {
 /**
 @brief Flip face winding
 
-The same as flipNormals(std::vector<UnsignedInt>&, std::vector<Vector3>&),
+The same as flipNormals(StridedArrayView<UnsignedInt>, StridedArrayView<Vector3>),
 but flips only face winding.
 */
-void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(std::vector<UnsignedInt>& indices);
+void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(StridedArrayView<UnsignedInt> indices);
+
+/** @overload */
+inline void flipFaceWinding(std::vector<UnsignedInt>& indices) {
+    flipFaceWinding(StridedArrayView<UnsignedInt>(indices));
+}
 
 /**
 @brief Flip mesh normals
 
-The same as flipNormals(std::vector<UnsignedInt>&, std::vector<Vector3>&),
+The same as flipNormals(StridedArrayView<UnsignedInt>, StridedArrayView<Vector3>),
 but flips only normals, not face winding.
 */
-void MAGNUM_MESHTOOLS_EXPORT flipNormals(std::vector<Vector3>& normals);
+void MAGNUM_MESHTOOLS_EXPORT flipNormals(StridedArrayView<Vector3> normals);
+
+/** @overload */
+inline void flipNormals(std::vector<Vector3>& normals) {
+    flipNormals(StridedArrayView<Vector3>(normals));
+}
 
 /**
 @brief Flip mesh normals and face winding
@@ -58,17 +69,22 @@ void MAGNUM_MESHTOOLS_EXPORT flipNormals(std::vector<Vector3>& normals);
 @param[in,out] normals  Normal array to operate on
 
 Flips normal vectors and face winding in index array for face culling to work
-properly too. See also flipNormals(std::vector<Vector3>&) and
+properly too. See also flipNormals(StridedArrayView<Vector3>) and
 flipFaceWinding(), which flip normals or face winding only.
 
 @attention The function requires the mesh to have triangle faces, thus index
     count must be divisible by 3.
 */
-inline void flipNormals(std::vector<UnsignedInt>& indices, std::vector<Vector3>& normals) {
+inline void flipNormals(StridedArrayView<UnsignedInt> indices, StridedArrayView<Vector3> normals) {
     flipFaceWinding(indices);
     flipNormals(normals);
 }
 
+/** @overload */
+inline void flipNormals(std::vector<UnsignedInt>& indices, std::vector<Vector3>& normals) {
+    flipNormals(StridedArrayView<UnsignedInt>(indices), StridedArrayView<Vector3>(normals));
+}
+
 }}
 
 #endif
@@ -29,7 +29,7 @@
 
 namespace Magnum { namespace MeshTools {
 
-std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(StridedArrayView<const UnsignedInt> indices, StridedArrayView<const Vector3> positions) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
 
     /* Create normal for every triangle (assuming counterclockwise winding) */
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Magnum.h"
+#include "StridedArrayView.h"
 
 #include "magnumMeshToolsVisibility.h"
 
@@ -59,7 +60,12 @@ use the same indices.
 @attention Index count must be divisible by 3, otherwise zero length result
     is generated.
 */
-std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(StridedArrayView<const UnsignedInt> indices, StridedArrayView<const Vector3> positions);
+
+/** @overload */
+inline std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
+    return generateFlatNormals(StridedArrayView<const UnsignedInt>(indices), StridedArrayView<const Vector3>(positions));
+}
 
 }}
 
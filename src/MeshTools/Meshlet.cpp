@@ -0,0 +1,191 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Meshlet.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "Math/Functions.h"
+#include "MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+Meshlet meshletBounds(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t indexOffset, std::size_t indexCount, UnsignedInt vertexCount) {
+    /* Bounding sphere centered in the middle of bounding box */
+    Vector3 min(std::numeric_limits<Float>::max());
+    Vector3 max(-std::numeric_limits<Float>::max());
+    for(std::size_t i = indexOffset; i != indexOffset+indexCount; ++i) {
+        min = Math::min(min, positions[indices[i]]);
+        max = Math::max(max, positions[indices[i]]);
+    }
+    const Vector3 center = (min + max)*0.5f;
+    Float radiusSquared = 0.0f;
+    for(std::size_t i = indexOffset; i != indexOffset+indexCount; ++i)
+        radiusSquared = std::max(radiusSquared, (positions[indices[i]] - center).dot());
+
+    /* Normal cone around average normal, degenerate triangles are skipped */
+    std::vector<Vector3> normals;
+    normals.reserve(indexCount/3);
+    Vector3 axis;
+    for(std::size_t i = indexOffset; i != indexOffset+indexCount; i += 3) {
+        const Vector3 normal = Vector3::cross(positions[indices[i+1]] - positions[indices[i]],
+                                              positions[indices[i+2]] - positions[indices[i]]);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+
+        normals.push_back(normal/length);
+        axis += normals.back();
+    }
+
+    /* Cutoff is sine of largest angle between the axis and the normals, if
+       the angle is too large the cone can't be used for culling */
+    Float cutoff = 1.0f;
+    const Float axisLength = axis.length();
+    if(axisLength != 0.0f) {
+        axis /= axisLength;
+        Float minDot = 1.0f;
+        for(const Vector3& normal: normals)
+            minDot = std::min(minDot, Vector3::dot(axis, normal));
+        if(minDot > 0.1f) cutoff = std::sqrt(1.0f - minDot*minDot);
+    }
+
+    return Meshlet(indexOffset, indexCount, vertexCount, center, std::sqrt(radiusSquared), axis, cutoff);
+}
+
+}
+
+std::vector<Meshlet> buildMeshlets(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::buildMeshlets(): index count is not divisible by 3!", {});
+    CORRADE_ASSERT(maxVertices >= 3 && maxTriangles >= 1, "MeshTools::buildMeshlets(): the meshlet must be able to contain at least one triangle", {});
+
+    /* Neighboring triangles and count of not yet emitted triangles for each
+       vertex */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify(indices, positions.size()).buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    /* Per-triangle emitted flag, per-vertex ID of meshlet in which the vertex
+       was last used */
+    const std::size_t triangleCount = indices.size()/3;
+    std::vector<bool> emitted(triangleCount);
+    std::vector<UnsignedInt> vertexMeshlet(positions.size(), ~UnsignedInt(0));
+
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    std::vector<Meshlet> meshlets;
+
+    /* Triangles neighboring current meshlet */
+    std::vector<UnsignedInt> candidates;
+    std::size_t meshletIndexOffset = 0;
+    UnsignedInt meshletVertexCount = 0;
+    Vector3 meshletPositionSum;
+    std::size_t cursor = 0;
+    for(std::size_t emittedCount = 0; emittedCount != triangleCount; ++emittedCount) {
+        /* Pick candidate adding the least new vertices to the meshlet. From
+           these prefer triangles with the least remaining neighbors, so no
+           small isolated groups of triangles are left behind, and then ones
+           closest to the meshlet centroid to keep it compact. Already emitted
+           triangles are removed on the way. */
+        const Vector3 meshletCentroid = meshletVertexCount ? meshletPositionSum/meshletVertexCount : Vector3();
+        UnsignedInt triangle = ~UnsignedInt(0);
+        UnsignedInt triangleNewVertices = 4;
+        UnsignedInt triangleLiveCount = 0;
+        Float triangleDistance = 0.0f;
+        for(std::size_t i = 0; i != candidates.size(); ) {
+            const UnsignedInt t = candidates[i];
+            if(emitted[t]) {
+                candidates[i] = candidates.back();
+                candidates.pop_back();
+                continue;
+            }
+
+            UnsignedInt newVertices = 0;
+            for(std::size_t j = 0; j != 3; ++j)
+                if(vertexMeshlet[indices[t*3+j]] != meshlets.size()) ++newVertices;
+            if(newVertices > triangleNewVertices) {
+                ++i;
+                continue;
+            }
+
+            const UnsignedInt liveCount = liveTriangleCount[indices[t*3]] + liveTriangleCount[indices[t*3+1]] + liveTriangleCount[indices[t*3+2]];
+            const Float distance = (positions[indices[t*3]] + positions[indices[t*3+1]] + positions[indices[t*3+2]] - meshletCentroid*3.0f).dot();
+            if(newVertices < triangleNewVertices || liveCount < triangleLiveCount || (liveCount == triangleLiveCount && distance < triangleDistance)) {
+                triangle = t;
+                triangleNewVertices = newVertices;
+                triangleLiveCount = liveCount;
+                triangleDistance = distance;
+            }
+
+            ++i;
+        }
+
+        /* Close the meshlet if the triangle doesn't fit into it or if there
+           are no more neighboring triangles */
+        if(triangle == ~UnsignedInt(0) || meshletVertexCount + triangleNewVertices > maxVertices || (outputIndices.size() - meshletIndexOffset)/3 == maxTriangles) {
+            if(outputIndices.size() != meshletIndexOffset) {
+                meshlets.push_back(meshletBounds(outputIndices, positions, meshletIndexOffset, outputIndices.size() - meshletIndexOffset, meshletVertexCount));
+                meshletIndexOffset = outputIndices.size();
+                meshletVertexCount = 0;
+                meshletPositionSum = {};
+            }
+
+            /* Continue from the same triangle in the new meshlet, if it is
+               connected to the previous one, otherwise take first triangle
+               which wasn't emitted yet */
+            if(triangle == ~UnsignedInt(0)) {
+                while(emitted[cursor]) ++cursor;
+                triangle = cursor;
+            }
+            candidates.clear();
+        }
+
+        /* Emit the triangle */
+        emitted[triangle] = true;
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt v = indices[triangle*3+j];
+            outputIndices.push_back(v);
+            --liveTriangleCount[v];
+            if(vertexMeshlet[v] == meshlets.size()) continue;
+
+            /* Add all triangles neighboring the new vertex to candidates */
+            vertexMeshlet[v] = meshlets.size();
+            ++meshletVertexCount;
+            meshletPositionSum += positions[v];
+            for(UnsignedInt ti = neighborOffset[v]; ti != neighborOffset[v+1]; ++ti)
+                if(!emitted[neighbors[ti]]) candidates.push_back(neighbors[ti]);
+        }
+    }
+
+    /* Last meshlet */
+    if(outputIndices.size() != meshletIndexOffset)
+        meshlets.push_back(meshletBounds(outputIndices, positions, meshletIndexOffset, outputIndices.size() - meshletIndexOffset, meshletVertexCount));
+
+    std::swap(indices, outputIndices);
+    return meshlets;
+}
+
+}}
@@ -0,0 +1,132 @@
+#ifndef Magnum_MeshTools_Meshlet_h
+#define Magnum_MeshTools_Meshlet_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::MeshTools::Meshlet, function Magnum::MeshTools::buildMeshlets()
+ */
+
+#include <vector>
+
+#include "Math/Vector3.h"
+#include "Magnum.h"
+
+#include "magnumMeshToolsVisibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Contiguous range of triangles in index array with bounding sphere and normal
+cone, usable for culling parts of the mesh on CPU before issuing the draw.
+@see buildMeshlets()
+*/
+class Meshlet {
+    public:
+        /** @brief Constructor */
+        inline constexpr explicit Meshlet(UnsignedInt indexOffset, UnsignedInt indexCount, UnsignedInt vertexCount, const Vector3& center, Float radius, const Vector3& coneAxis, Float coneCutoff): _indexOffset(indexOffset), _indexCount(indexCount), _vertexCount(vertexCount), _center(center), _radius(radius), _coneAxis(coneAxis), _coneCutoff(coneCutoff) {}
+
+        /** @brief Offset of first index of the meshlet in index array */
+        inline constexpr UnsignedInt indexOffset() const { return _indexOffset; }
+
+        /** @brief Count of indices in the meshlet */
+        inline constexpr UnsignedInt indexCount() const { return _indexCount; }
+
+        /** @brief Count of unique vertices referenced by the meshlet */
+        inline constexpr UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /** @brief Center of bounding sphere */
+        inline constexpr Vector3 center() const { return _center; }
+
+        /** @brief Radius of bounding sphere */
+        inline constexpr Float radius() const { return _radius; }
+
+        /** @brief Normalized average normal of all triangles */
+        inline constexpr Vector3 coneAxis() const { return _coneAxis; }
+
+        /**
+         * @brief Normal cone cutoff
+         *
+         * Sine of largest angle between cone axis and triangle normal. Value
+         * of `1.0f` means that the triangle normals are spread too much and
+         * the meshlet can't be culled using the cone.
+         * @see isBackFacing()
+         */
+        inline constexpr Float coneCutoff() const { return _coneCutoff; }
+
+        /**
+         * @brief Whether the meshlet is back-facing
+         *
+         * Returns `true` if all triangles of the meshlet are guaranteed to be
+         * back-facing when viewed from given camera position.
+         */
+        inline bool isBackFacing(const Vector3& cameraPosition) const {
+            const Vector3 direction = _center - cameraPosition;
+            return Vector3::dot(direction, _coneAxis) >= _coneCutoff*direction.length() + _radius;
+        }
+
+    private:
+        UnsignedInt _indexOffset, _indexCount, _vertexCount;
+        Vector3 _center;
+        Float _radius;
+        Vector3 _coneAxis;
+        Float _coneCutoff;
+};
+
+/**
+@brief Build meshlets
+@param[in,out] indices  Index array to operate on
+@param[in] positions    Vertex positions
+@param[in] maxVertices  Max count of unique vertices in one meshlet
+@param[in] maxTriangles Max count of triangles in one meshlet
+
+Reorders the triangles in index array into spatially coherent meshlets, each
+of them referencing at most @p maxVertices vertices and containing at most
+@p maxTriangles triangles. The meshlets are grown greedily over triangle
+adjacency, preferring triangles adding the least new vertices. Returned list
+describes position of each meshlet in the index array together with its
+bounding sphere and normal cone. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<MeshTools::Meshlet> meshlets = MeshTools::buildMeshlets(indices, positions, 64, 126);
+
+// ...
+
+for(const MeshTools::Meshlet& meshlet: meshlets) {
+    if(meshlet.isBackFacing(cameraPosition)) continue;
+    // draw the index range [indexOffset(), indexOffset() + indexCount()) ...
+}
+@endcode
+
+@attention Index count must be divisible by 3, @p maxVertices must be at least
+    3 and @p maxTriangles must be at least 1.
+*/
+std::vector<Meshlet> MAGNUM_MESHTOOLS_EXPORT buildMeshlets(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertices, UnsignedInt maxTriangles);
+
+}}
+
+#endif
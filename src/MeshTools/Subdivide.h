@@ -28,9 +28,12 @@
  * @brief Function Magnum::MeshTools::subdivide()
  */
 
+#include <unordered_map>
 #include <vector>
 #include <Utility/Debug.h>
 
+#include "Types.h"
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
@@ -45,12 +48,24 @@ template<class Vertex, class Interpolator> class Subdivide {
             std::size_t indexCount = indices.size();
             indices.reserve(indices.size()*4);
 
+            /* Each edge is (in a closed mesh) shared by two faces, thus there
+               is about half as many edges as indices */
+            edges.reserve(indexCount/2);
+            vertices.reserve(vertices.size() + indexCount/2);
+
             /* Subdivide each face to four new */
             for(std::size_t i = 0; i != indexCount; i += 3) {
-                /* Interpolate each side */
+                /* Interpolate each side, reuse the vertex if the edge was
+                   already interpolated for neighboring face */
                 UnsignedInt newVertices[3];
-                for(int j = 0; j != 3; ++j)
-                    newVertices[j] = addVertex(interpolator(vertices[indices[i+j]], vertices[indices[i+(j+1)%3]]));
+                for(int j = 0; j != 3; ++j) {
+                    const UnsignedInt a = indices[i+j];
+                    const UnsignedInt b = indices[i+(j+1)%3];
+                    auto inserted = edges.insert(std::make_pair(edgeKey(a, b), UnsignedInt(vertices.size())));
+                    if(inserted.second)
+                        addVertex(interpolator(vertices[a], vertices[b]));
+                    newVertices[j] = inserted.first->second;
+                }
 
                 /*
                  * Add three new faces (0, 1, 3) and update original (2)
@@ -76,6 +91,12 @@ template<class Vertex, class Interpolator> class Subdivide {
     private:
         std::vector<UnsignedInt>& indices;
         std::vector<Vertex>& vertices;
+        std::unordered_map<UnsignedLong, UnsignedInt> edges;
+
+        /* Key independent on edge orientation */
+        inline static UnsignedLong edgeKey(UnsignedInt a, UnsignedInt b) {
+            return a < b ? (UnsignedLong(a) << 32)|b : (UnsignedLong(b) << 32)|a;
+        }
 
         UnsignedInt addVertex(const Vertex& v) {
             vertices.push_back(v);
@@ -100,8 +121,10 @@ template<class Vertex, class Interpolator> class Subdivide {
 @param interpolator     Functor or function pointer which interpolates
     two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
 
-Goes through all triangle faces and subdivides them into four new. Cleaning
-duplicate vertices in the mesh is up to user.
+Goes through all triangle faces and subdivides them into four new. Edges
+shared by more faces (i.e. referencing the same pair of indices) get only one
+new vertex, so the subdivided mesh doesn't contain duplicate vertices if the
+original one didn't contain any.
 */
 template<class Vertex, class Interpolator> inline void subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
     Implementation::Subdivide<Vertex, Interpolator>(indices, vertices)(interpolator);
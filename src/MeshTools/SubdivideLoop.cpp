@@ -0,0 +1,170 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "SubdivideLoop.h"
+
+#include <unordered_map>
+
+#include "Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+namespace {
+
+struct Edge {
+    inline Edge(): faceCount(0), split(false), vertex(~UnsignedInt(0)) {}
+
+    UnsignedInt faceCount;
+    bool split;
+    UnsignedInt vertex;
+    UnsignedInt opposite[2];
+};
+
+/* Key independent on edge orientation */
+inline UnsignedLong edgeKey(UnsignedInt a, UnsignedInt b) {
+    return a < b ? (UnsignedLong(a) << 32)|b : (UnsignedLong(b) << 32)|a;
+}
+
+}
+
+void SubdivideLoop::operator()(std::vector<bool> faces) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideLoop(): index count is not divisible by 3!", );
+
+    /* Gather all edges with their opposite vertices. Pointers to unordered_map
+       elements are stable across insertions, so they can be saved for faster
+       access later. */
+    std::unordered_map<UnsignedLong, Edge> edges;
+    edges.reserve(indices.size()/2);
+    std::vector<Edge*> faceEdges(indices.size());
+    for(std::size_t i = 0; i != indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j) {
+        Edge& edge = edges[edgeKey(indices[i+j], indices[i+(j+1)%3])];
+        if(edge.faceCount < 2) edge.opposite[edge.faceCount] = indices[i+(j+2)%3];
+        ++edge.faceCount;
+        faceEdges[i+j] = &edge;
+    }
+
+    /* Split all edges of marked faces. Faces with two or more split edges are
+       marked for full subdivision too, repeat until nothing changes. Faces
+       with only one split edge are then split in two halves. */
+    for(std::size_t i = 0; i != faces.size(); ++i) if(faces[i])
+        for(std::size_t j = 0; j != 3; ++j) faceEdges[i*3+j]->split = true;
+    for(bool changed = true; changed; ) {
+        changed = false;
+        for(std::size_t i = 0; i != faces.size(); ++i) {
+            if(faces[i]) continue;
+
+            std::size_t splitCount = 0;
+            for(std::size_t j = 0; j != 3; ++j)
+                if(faceEdges[i*3+j]->split) ++splitCount;
+            if(splitCount < 2) continue;
+
+            faces[i] = true;
+            for(std::size_t j = 0; j != 3; ++j) faceEdges[i*3+j]->split = true;
+            changed = true;
+        }
+    }
+
+    /* Compute smoothed positions of original vertices. Vertices with exactly
+       two crease edges are smoothed along the crease, vertices with more
+       crease edges are corners and stay in place. */
+    std::vector<Vector3> neighborSum(positions.size());
+    std::vector<UnsignedInt> valence(positions.size());
+    std::vector<Vector3> creaseSum(positions.size());
+    std::vector<UnsignedInt> creaseValence(positions.size());
+    for(const auto& edge: edges) {
+        const UnsignedInt a = edge.first >> 32;
+        const UnsignedInt b = edge.first & 0xffffffffu;
+        neighborSum[a] += positions[b];
+        neighborSum[b] += positions[a];
+        ++valence[a];
+        ++valence[b];
+
+        if(edge.second.faceCount != 2) {
+            creaseSum[a] += positions[b];
+            creaseSum[b] += positions[a];
+            ++creaseValence[a];
+            ++creaseValence[b];
+        }
+    }
+
+    std::vector<Vector3> result(positions.size());
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        if(creaseValence[i] == 2)
+            result[i] = positions[i]*0.75f + creaseSum[i]*0.125f;
+        else if(creaseValence[i] || !valence[i])
+            result[i] = positions[i];
+        else {
+            const Float beta = valence[i] == 3 ? 3.0f/16.0f : 3.0f/(8.0f*valence[i]);
+            result[i] = positions[i]*(1.0f - valence[i]*beta) + neighborSum[i]*beta;
+        }
+    }
+
+    /* Add new vertices on split edges in order in which they are referenced
+       from the faces, so the output is deterministic */
+    result.reserve(result.size() + edges.size());
+    for(std::size_t i = 0; i != indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j) {
+        Edge& edge = *faceEdges[i+j];
+        if(!edge.split || edge.vertex != ~UnsignedInt(0)) continue;
+
+        const Vector3& a = positions[indices[i+j]];
+        const Vector3& b = positions[indices[i+(j+1)%3]];
+        edge.vertex = result.size();
+        if(edge.faceCount == 2)
+            result.push_back((a + b)*0.375f + (positions[edge.opposite[0]] + positions[edge.opposite[1]])*0.125f);
+        else
+            result.push_back((a + b)*0.5f);
+    }
+
+    /* Create new faces */
+    std::vector<UnsignedInt> resultIndices;
+    resultIndices.reserve(indices.size()*4);
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt* const v = indices.data() + i;
+        Edge* const* const e = faceEdges.data() + i;
+
+        /* Full subdivision into three corner faces and the middle one */
+        if(faces[i/3]) {
+            resultIndices.insert(resultIndices.end(), {
+                v[0], e[0]->vertex, e[2]->vertex,
+                e[0]->vertex, v[1], e[1]->vertex,
+                e[2]->vertex, e[1]->vertex, v[2],
+                e[0]->vertex, e[1]->vertex, e[2]->vertex});
+            continue;
+        }
+
+        /* Split in two halves along the split edge, if any */
+        std::size_t j = 0;
+        while(j != 3 && !e[j]->split) ++j;
+        if(j == 3) resultIndices.insert(resultIndices.end(), {v[0], v[1], v[2]});
+        else resultIndices.insert(resultIndices.end(), {
+            v[j], e[j]->vertex, v[(j+2)%3],
+            e[j]->vertex, v[(j+1)%3], v[(j+2)%3]});
+    }
+
+    positions = std::move(result);
+    indices = std::move(resultIndices);
+}
+
+}}}
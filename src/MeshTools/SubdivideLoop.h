@@ -0,0 +1,119 @@
+#ifndef Magnum_MeshTools_SubdivideLoop_h
+#define Magnum_MeshTools_SubdivideLoop_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function Magnum::MeshTools::subdivideLoop()
+ */
+
+#include <vector>
+
+#include "Magnum.h"
+
+#include "magnumMeshToolsVisibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+
+class MAGNUM_MESHTOOLS_EXPORT SubdivideLoop {
+    public:
+        inline SubdivideLoop(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions): indices(indices), positions(positions) {}
+
+        /**
+         * @brief Subdivide marked faces
+         *
+         * Subdivides faces which have corresponding bit in @p faces set and
+         * also their neighbors, if needed to avoid T-junctions (used
+         * internally).
+         */
+        void operator()(std::vector<bool> faces);
+
+    private:
+        std::vector<UnsignedInt>& indices;
+        std::vector<Vector3>& positions;
+};
+
+}
+
+/**
+@brief %Subdivide the mesh using Loop scheme
+@param[in,out] indices      Index array to operate on
+@param[in,out] positions    Vertex positions to operate on
+
+Subdivides each triangle face into four new and moves both old and new vertices
+to approximate smooth limit surface. Boundary edges (and edges shared by more
+than two faces) are treated as creases. Algorithm used: *Charles Loop - Smooth
+Subdivision Surfaces Based on Triangles, M.S. Mathematics thesis, University of
+Utah, 1987*.
+
+Unlike subdivide() the scheme is fixed, thus only vertex positions can be
+subdivided, other vertex attributes (e.g. normals) should be regenerated
+afterwards.
+
+@attention Index count must be divisible by 3.
+@see subdivideLoop(std::vector<UnsignedInt>&, std::vector<Vector3>&, Criterion)
+*/
+inline void subdivideLoop(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    Implementation::SubdivideLoop(indices, positions)(std::vector<bool>(indices.size()/3, true));
+}
+
+/**
+@brief Adaptively subdivide the mesh using Loop scheme
+@tparam Criterion           See `criterion` function parameter
+@param[in,out] indices      Index array to operate on
+@param[in,out] positions    Vertex positions to operate on
+@param criterion            Functor or function pointer which decides whether
+    given face should be subdivided:
+    `bool criterion(const Vector3& a, const Vector3& b, const Vector3& c)`
+
+Subdivides only faces for which @p criterion returns `true`, e.g. faces with
+large projected size or high curvature. Neighboring faces are subdivided in
+two halves (or fully, if two or more of their edges are split) so the
+resulting mesh doesn't contain any T-junctions. All original vertices are
+smoothed, so the surface stays continuous also across the border of
+subdivided area. See subdivideLoop(std::vector<UnsignedInt>&, std::vector<Vector3>&)
+for more information.
+
+Example usage, subdividing only faces with edges longer than `0.1`:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+MeshTools::subdivideLoop(indices, positions, [](const Vector3& a, const Vector3& b, const Vector3& c) {
+    return (b-a).dot() > 0.01f || (c-b).dot() > 0.01f || (a-c).dot() > 0.01f;
+});
+@endcode
+*/
+template<class Criterion> void subdivideLoop(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, Criterion criterion) {
+    std::vector<bool> faces(indices.size()/3);
+    for(std::size_t i = 0; i != faces.size(); ++i)
+        faces[i] = criterion(positions[indices[i*3]], positions[indices[i*3+1]], positions[indices[i*3+2]]);
+
+    Implementation::SubdivideLoop(indices, positions)(std::move(faces));
+}
+
+}}
+
+#endif
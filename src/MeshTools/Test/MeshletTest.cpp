@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <algorithm>
+#include <array>
+#include <set>
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "MeshTools/Meshlet.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class MeshletTest: public Corrade::TestSuite::Tester {
+    public:
+        MeshletTest();
+
+        void wrongIndexCount();
+        void wrongLimits();
+        void build();
+        void bounds();
+        void backFacing();
+
+    private:
+        std::vector<UnsignedInt> indices;
+        std::vector<Vector3> positions;
+};
+
+MeshletTest::MeshletTest() {
+    addTests({&MeshletTest::wrongIndexCount,
+              &MeshletTest::wrongLimits,
+              &MeshletTest::build,
+              &MeshletTest::bounds,
+              &MeshletTest::backFacing});
+
+    /* 16x16 grid of quads in XY plane facing +Z */
+    for(UnsignedInt y = 0; y != 17; ++y)
+        for(UnsignedInt x = 0; x != 17; ++x)
+            positions.push_back({Float(x), Float(y), 0.0f});
+    for(UnsignedInt y = 0; y != 16; ++y) for(UnsignedInt x = 0; x != 16; ++x) {
+        const UnsignedInt i = y*17 + x;
+        indices.insert(indices.end(), {i, i + 1, i + 18,
+                                       i, i + 18, i + 17});
+    }
+}
+
+void MeshletTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> indices{0, 1};
+    CORRADE_VERIFY(MeshTools::buildMeshlets(indices, positions, 64, 126).empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::buildMeshlets(): index count is not divisible by 3!\n");
+}
+
+void MeshletTest::wrongLimits() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    CORRADE_VERIFY(MeshTools::buildMeshlets(indices, positions, 2, 126).empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::buildMeshlets(): the meshlet must be able to contain at least one triangle\n");
+}
+
+void MeshletTest::build() {
+    std::vector<UnsignedInt> original = indices;
+    std::vector<Meshlet> meshlets = MeshTools::buildMeshlets(indices, positions, 16, 20);
+
+    /* All triangles are preserved */
+    CORRADE_COMPARE(indices.size(), original.size());
+    std::multiset<std::array<UnsignedInt, 3>> originalTriangles, triangles;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        originalTriangles.insert({{original[i], original[i+1], original[i+2]}});
+        triangles.insert({{indices[i], indices[i+1], indices[i+2]}});
+    }
+    CORRADE_VERIFY(triangles == originalTriangles);
+
+    /* Meshlets are contiguous, cover whole index array and respect limits */
+    CORRADE_VERIFY(meshlets.size() >= 512/20 + 1);
+    std::size_t offset = 0;
+    for(const Meshlet& meshlet: meshlets) {
+        CORRADE_COMPARE(meshlet.indexOffset(), offset);
+        CORRADE_VERIFY(meshlet.indexCount() <= 20*3);
+        CORRADE_VERIFY(meshlet.vertexCount() <= 16);
+
+        std::set<UnsignedInt> vertices(indices.begin()+meshlet.indexOffset(), indices.begin()+meshlet.indexOffset()+meshlet.indexCount());
+        CORRADE_COMPARE(vertices.size(), meshlet.vertexCount());
+
+        offset += meshlet.indexCount();
+    }
+    CORRADE_COMPARE(offset, indices.size());
+}
+
+void MeshletTest::bounds() {
+    std::vector<Meshlet> meshlets = MeshTools::buildMeshlets(indices, positions, 16, 20);
+
+    for(const Meshlet& meshlet: meshlets) {
+        /* All vertices are inside bounding sphere */
+        for(std::size_t i = meshlet.indexOffset(); i != meshlet.indexOffset()+meshlet.indexCount(); ++i)
+            CORRADE_VERIFY((positions[indices[i]] - meshlet.center()).length() <= meshlet.radius()*1.0001f);
+
+        /* Flat mesh has the narrowest cone possible */
+        CORRADE_COMPARE(meshlet.coneAxis(), Vector3::zAxis());
+        CORRADE_COMPARE(meshlet.coneCutoff(), 0.0f);
+    }
+}
+
+void MeshletTest::backFacing() {
+    std::vector<Meshlet> meshlets = MeshTools::buildMeshlets(indices, positions, 16, 20);
+
+    for(const Meshlet& meshlet: meshlets) {
+        CORRADE_VERIFY(!meshlet.isBackFacing({8.0f, 8.0f, 10.0f}));
+        CORRADE_VERIFY(meshlet.isBackFacing({8.0f, 8.0f, -10.0f}));
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshletTest)
@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/Vector3.h"
+#include "MeshTools/SubdivideLoop.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SubdivideLoopTest: public Corrade::TestSuite::Tester {
+    public:
+        SubdivideLoopTest();
+
+        void wrongIndexCount();
+        void closed();
+        void boundary();
+        void adaptive();
+};
+
+SubdivideLoopTest::SubdivideLoopTest() {
+    addTests({&SubdivideLoopTest::wrongIndexCount,
+              &SubdivideLoopTest::closed,
+              &SubdivideLoopTest::boundary,
+              &SubdivideLoopTest::adaptive});
+}
+
+void SubdivideLoopTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::subdivideLoop(indices, positions);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::subdivideLoop(): index count is not divisible by 3!\n");
+}
+
+void SubdivideLoopTest::closed() {
+    /* Tetrahedron, all vertices have valence 3 */
+    std::vector<Vector3> positions{{ 1.0f,  1.0f,  1.0f},
+                                   { 1.0f, -1.0f, -1.0f},
+                                   {-1.0f,  1.0f, -1.0f},
+                                   {-1.0f, -1.0f,  1.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2,
+                                     0, 2, 3,
+                                     0, 3, 1,
+                                     1, 3, 2};
+    MeshTools::subdivideLoop(indices, positions);
+
+    CORRADE_COMPARE(indices.size(), 48);
+    CORRADE_COMPARE(positions.size(), 10);
+
+    /* Original vertices are moved towards the center, new vertices on edges
+       0-1, 1-2 and 2-0 are added first */
+    CORRADE_COMPARE(std::vector<Vector3>(positions.begin(), positions.begin()+7), (std::vector<Vector3>{
+        { 0.25f,  0.25f,  0.25f},
+        { 0.25f, -0.25f, -0.25f},
+        {-0.25f,  0.25f, -0.25f},
+        {-0.25f, -0.25f,  0.25f},
+        { 0.5f,   0.0f,   0.0f},
+        { 0.0f,   0.0f,  -0.5f},
+        { 0.0f,   0.5f,   0.0f}}));
+    CORRADE_COMPARE(std::vector<UnsignedInt>(indices.begin(), indices.begin()+12), (std::vector<UnsignedInt>{
+        0, 4, 6,
+        4, 1, 5,
+        6, 5, 2,
+        4, 5, 6}));
+}
+
+void SubdivideLoopTest::boundary() {
+    std::vector<Vector3> positions{{0.0f, 0.0f, 0.0f},
+                                   {4.0f, 0.0f, 0.0f},
+                                   {0.0f, 4.0f, 0.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    MeshTools::subdivideLoop(indices, positions);
+
+    /* All edges are creases */
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{
+        {0.5f, 0.5f, 0.0f},
+        {3.0f, 0.5f, 0.0f},
+        {0.5f, 3.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {2.0f, 2.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f}}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 3, 5,
+        3, 1, 4,
+        5, 4, 2,
+        3, 4, 5}));
+}
+
+void SubdivideLoopTest::adaptive() {
+    std::vector<Vector3> positions{{0.0f, 0.0f, 0.0f},
+                                   {2.0f, 0.0f, 0.0f},
+                                   {2.0f, 2.0f, 0.0f},
+                                   {0.0f, 2.0f, 0.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2,
+                                     0, 2, 3};
+
+    /* Subdivide only the first face */
+    MeshTools::subdivideLoop(indices, positions, [](const Vector3&, const Vector3& b, const Vector3&) {
+        return b.y() == 0.0f;
+    });
+
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{
+        {0.25f, 0.25f, 0.0f},
+        {1.75f, 0.25f, 0.0f},
+        {1.75f, 1.75f, 0.0f},
+        {0.25f, 1.75f, 0.0f},
+        {1.0f,  0.0f,  0.0f},
+        {2.0f,  1.0f,  0.0f},
+        {1.0f,  1.0f,  0.0f}}));
+
+    /* Second face is split in two along the shared edge to avoid T-junction */
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 4, 6,
+        4, 1, 5,
+        6, 5, 2,
+        4, 5, 6,
+
+        0, 6, 3,
+        6, 2, 3}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideLoopTest)
@@ -79,12 +79,13 @@ void SubdivideTest::subdivide() {
 
     CORRADE_COMPARE(indices.size(), 24);
 
-    CORRADE_VERIFY(positions == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 4, 7, 5}));
-    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 7, 8, 9, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 7, 9, 7, 2, 8, 9, 8, 3}));
+    /* Vertex for shared edge 1-2 is added only once */
+    CORRADE_VERIFY(positions == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 7, 5}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 5, 7, 8, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 5, 8, 5, 2, 7, 8, 7, 3}));
 
     MeshTools::clean(indices, positions);
 
-    /* Positions 0, 1, 2, 3, 4, 5, 6, 7, 8 */
+    /* Positions 0, 1, 2, 3, 4, 5, 6, 7, 8, nothing to clean */
     CORRADE_COMPARE(positions.size(), 9);
 }
 
@@ -40,6 +40,10 @@ class TransformTest: public Corrade::TestSuite::Tester {
 
         void transformPoints2D();
         void transformPoints3D();
+
+        void transformVectorsContiguous();
+        void transformPointsContiguous();
+        void transformPointsStrided();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +51,11 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformVectorsContiguous,
+              &TransformTest::transformPointsContiguous,
+              &TransformTest::transformPointsStrided});
 }
 
 /* GCC < 4.7 doesn't like constexpr here, don't know why */
@@ -125,6 +133,63 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+void TransformTest::transformVectorsContiguous() {
+    /* Large enough to be split across more threads */
+    std::vector<Vector3> vectors(300001);
+    for(std::size_t i = 0; i != vectors.size(); ++i)
+        vectors[i] = points3D[i%2]/10.0f;
+
+    auto matrix = MeshTools::transformVectors(Matrix4::rotationZ(Deg(90.0f)), vectors);
+    auto quaternion = MeshTools::transformVectors(Quaternion::rotation(Deg(90.0f), Vector3::zAxis()), vectors);
+
+    CORRADE_COMPARE(matrix.size(), vectors.size());
+    CORRADE_COMPARE(quaternion.size(), vectors.size());
+    for(std::size_t i: {0, 1, 150000, 300000}) {
+        CORRADE_COMPARE(matrix[i], points3DRotated[i%2]/10.0f);
+        CORRADE_COMPARE(quaternion[i], points3DRotated[i%2]/10.0f);
+    }
+}
+
+void TransformTest::transformPointsContiguous() {
+    std::vector<Vector3> points(300001);
+    for(std::size_t i = 0; i != points.size(); ++i)
+        points[i] = points3D[i%2]/10.0f;
+
+    auto matrix = MeshTools::transformPoints(
+        Matrix4::translation(Vector3::yAxis(-0.1f))*Matrix4::rotationZ(Deg(90.0f)), points);
+    auto quaternion = MeshTools::transformPoints(
+        DualQuaternion::translation(Vector3::yAxis(-0.1f))*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis()), points);
+
+    CORRADE_COMPARE(matrix.size(), points.size());
+    CORRADE_COMPARE(quaternion.size(), points.size());
+    for(std::size_t i: {0, 1, 150000, 300000}) {
+        CORRADE_COMPARE(matrix[i], points3DRotatedTranslated[i%2]/10.0f);
+        CORRADE_COMPARE(quaternion[i], points3DRotatedTranslated[i%2]/10.0f);
+    }
+}
+
+void TransformTest::transformPointsStrided() {
+    /* Interleaved data, large enough to be split across more threads, the
+       other attribute shouldn't be touched */
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoords;
+    };
+    std::vector<Vertex> vertices(300001);
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        vertices[i].position = points3D[i%2]/10.0f;
+        vertices[i].textureCoords = {1.0f, 2.0f};
+    }
+
+    MeshTools::transformPointsInPlace(Matrix4::translation(Vector3::yAxis(-0.1f))*Matrix4::rotationZ(Deg(90.0f)),
+        StridedArrayView<Vector3>(&vertices[0].position, vertices.size(), sizeof(Vertex)));
+
+    for(std::size_t i: {0, 1, 150000, 300000}) {
+        CORRADE_COMPARE(vertices[i].position, points3DRotatedTranslated[i%2]/10.0f);
+        CORRADE_COMPARE(vertices[i].textureCoords, Vector2(1.0f, 2.0f));
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
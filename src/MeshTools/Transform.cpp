@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Transform.h"
+
+#include <algorithm>
+#include <corradeConfigure.h>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Minimal count of vectors transformed by one thread, below that the overhead
+   of spawning the thread is larger than the gain */
+constexpr std::size_t MinimalChunkSize = 65536;
+
+/* Columns of the matrix are fetched outside of the loop, so the loop body is
+   only three multiply-adds per vector without any branching. Contiguous
+   arrays have separate loop so the compiler can vectorize it. */
+template<bool translate> void transformChunk(const Matrix4& matrix, StridedArrayView<Vector3> data) {
+    const Vector3 x = matrix[0].xyz();
+    const Vector3 y = matrix[1].xyz();
+    const Vector3 z = matrix[2].xyz();
+    const Vector3 t = translate ? matrix[3].xyz() : Vector3();
+
+    if(data.isContiguous()) {
+        for(Vector3 *it = data.data(), *end = data.data() + data.size(); it != end; ++it) {
+            const Vector3 v = *it;
+            *it = x*v.x() + y*v.y() + z*v.z() + t;
+        }
+    } else for(Vector3& it: data) {
+        const Vector3 v = it;
+        it = x*v.x() + y*v.y() + z*v.z() + t;
+    }
+}
+
+/* Chunk of given view */
+inline StridedArrayView<Vector3> chunk(StridedArrayView<Vector3> data, std::size_t begin, std::size_t end) {
+    return StridedArrayView<Vector3>(&data[begin], end - begin, data.stride());
+}
+
+template<bool translate> void transform(const Matrix4& matrix, StridedArrayView<Vector3> data) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t threadCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), data.size()/MinimalChunkSize);
+    #else
+    std::size_t threadCount = 1;
+    #endif
+
+    /* Not worth parallelizing */
+    if(threadCount <= 1) {
+        transformChunk<translate>(matrix, data);
+        return;
+    }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Spawn threads for all chunks except the last one, which is transformed
+       on current thread */
+    const std::size_t chunkSize = (data.size() + threadCount - 1)/threadCount;
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for(std::size_t i = 0; i != threadCount - 1; ++i)
+        threads.emplace_back(transformChunk<translate>, std::cref(matrix), chunk(data, i*chunkSize, (i + 1)*chunkSize));
+
+    transformChunk<translate>(matrix, chunk(data, (threadCount - 1)*chunkSize, data.size()));
+    for(std::thread& thread: threads) thread.join();
+    #endif
+}
+
+}
+
+void transformVectorsInPlace(const Quaternion& normalizedQuaternion, StridedArrayView<Vector3> vectors) {
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(),
+        "MeshTools::transformVectorsInPlace(): quaternion must be normalized", );
+    transform<false>(Matrix4::from(normalizedQuaternion.toMatrix(), {}), vectors);
+}
+
+void transformVectorsInPlace(const Matrix4& matrix, StridedArrayView<Vector3> vectors) {
+    transform<false>(matrix, vectors);
+}
+
+void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, StridedArrayView<Vector3> points) {
+    CORRADE_ASSERT(normalizedDualQuaternion.isNormalized(),
+        "MeshTools::transformPointsInPlace(): dual quaternion must be normalized", );
+    transform<true>(normalizedDualQuaternion.toMatrix(), points);
+}
+
+void transformPointsInPlace(const Matrix4& matrix, StridedArrayView<Vector3> points) {
+    transform<true>(matrix, points);
+}
+
+}}
@@ -28,14 +28,86 @@
  * @brief Function Magnum::MeshTools::transformVectorsInPlace(), Magnum::MeshTools::transformVectors(), Magnum::MeshTools::transformPointsInPlace(), Magnum::MeshTools::transformPoints()
  */
 
+#include <vector>
+
 #include "Math/DualQuaternion.h"
 #include "Math/DualComplex.h"
+#include "Magnum.h"
+#include "StridedArrayView.h"
+
+#include "magnumMeshToolsVisibility.h"
 
 namespace Magnum { namespace MeshTools {
 
 /**
 @brief Transform vectors in-place using given transformation
 
+Specialization for array of three-component float vectors, usable for baking
+large static geometry. The vectors can be also strided view into e.g.
+interleaved vertex buffer or Trade::MeshDataView3D. The quaternion is
+converted to rotation matrix only once and the vectors are transformed in a
+tight loop which can be auto-vectorized by the compiler if the view is
+contiguous. Large arrays are split into equally sized
+chunks and transformed in parallel on all available hardware threads. Expects
+that the quaternion is normalized.
+@see transformVectorsInPlace(const Math::Quaternion<T>&, U&)
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Quaternion& normalizedQuaternion, StridedArrayView<Vector3> vectors);
+
+/** @overload */
+inline void transformVectorsInPlace(const Quaternion& normalizedQuaternion, std::vector<Vector3>& vectors) {
+    transformVectorsInPlace(normalizedQuaternion, StridedArrayView<Vector3>(vectors));
+}
+
+/**
+@brief Transform vectors in-place using given transformation
+
+Specialization for array of three-component float vectors. See
+transformVectorsInPlace(const Quaternion&, StridedArrayView<Vector3>) for more
+information.
+@see transformVectorsInPlace(const Math::Matrix4<T>&, U&)
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Matrix4& matrix, StridedArrayView<Vector3> vectors);
+
+/** @overload */
+inline void transformVectorsInPlace(const Matrix4& matrix, std::vector<Vector3>& vectors) {
+    transformVectorsInPlace(matrix, StridedArrayView<Vector3>(vectors));
+}
+
+/**
+@brief Transform points in-place using given transformation
+
+Specialization for array of three-component float vectors. The dual
+quaternion is converted to transformation matrix only once, see
+transformVectorsInPlace(const Quaternion&, StridedArrayView<Vector3>) for more
+information. Expects that the dual quaternion is normalized.
+@see transformPointsInPlace(const Math::DualQuaternion<T>&, U&)
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, StridedArrayView<Vector3> points);
+
+/** @overload */
+inline void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, std::vector<Vector3>& points) {
+    transformPointsInPlace(normalizedDualQuaternion, StridedArrayView<Vector3>(points));
+}
+
+/**
+@brief Transform points in-place using given transformation
+
+Specialization for array of three-component float vectors. See
+transformVectorsInPlace(const Quaternion&, StridedArrayView<Vector3>) for more
+information.
+@see transformPointsInPlace(const Math::Matrix4<T>&, U&)
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const Matrix4& matrix, StridedArrayView<Vector3> points);
+
+/** @overload */
+inline void transformPointsInPlace(const Matrix4& matrix, std::vector<Vector3>& points) {
+    transformPointsInPlace(matrix, StridedArrayView<Vector3>(points));
+}
+
+/**
+@brief Transform vectors in-place using given transformation
+
 Usable for one-time mesh transformations that would otherwise negatively affect
 dependent objects, such as (uneven) scaling. Accepts any forward-iterable type
 with compatible vector type as @p vectors. Expects that @ref Math::Quaternion "Quaternion"
@@ -54,7 +126,7 @@ MeshTools::transformVectorsInPlace(rotation, vectors);
 
 @see transformVectors(), Matrix3::transformVector(), Matrix4::transformVector(),
     Complex::transformVectorNormalized(), Quaternion::transformVectorNormalized()
-@todo GPU transform feedback implementation (otherwise this is only bad joke)
+@todo GPU transform feedback implementation
 */
 template<class T, class U> void transformVectorsInPlace(const Math::Quaternion<T>& normalizedQuaternion, U& vectors) {
     for(auto& vector: vectors) vector = normalizedQuaternion.transformVectorNormalized(vector);
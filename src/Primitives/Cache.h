@@ -0,0 +1,132 @@
+#ifndef Magnum_Primitives_Cache_h
+#define Magnum_Primitives_Cache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Primitives::Cache
+ */
+
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "Trade/MeshData2D.h"
+#include "Trade/MeshData3D.h"
+
+#include "Primitives/magnumPrimitivesVisibility.h"
+
+namespace Magnum { namespace Primitives {
+
+/**
+@brief Cache of generated primitives
+
+Each call to e.g. UVSphere::solid() generates the data again, which is
+wasteful if the same primitive is used in many places. The cache calls the
+generator function only for first request with given parameters and for all
+subsequent requests returns reference to the same immutable data. The data are
+kept until clear() is called or the cache is destroyed. Example usage:
+@code
+Primitives::Cache cache;
+const Trade::MeshData3D& sphere = cache.get(Primitives::UVSphere::solid, 16, 32, Primitives::UVSphere::TextureCoords::DontGenerate);
+const Trade::MeshData2D& circle = cache.get(Primitives::Circle::wireframe, 40);
+@endcode
+
+As default function parameters aren't part of function pointer type, all
+parameters must be specified explicitly. The cache is not thread-safe.
+*/
+class MAGNUM_PRIMITIVES_EXPORT Cache {
+    Cache(const Cache&) = delete;
+    Cache(Cache&&) = delete;
+    Cache& operator=(const Cache&) = delete;
+    Cache& operator=(Cache&&) = delete;
+
+    public:
+        /** @brief Constructor */
+        inline explicit Cache() = default;
+
+        /** @brief Destructor */
+        ~Cache();
+
+        /** @brief Count of cached primitives */
+        inline std::size_t count() const { return _data2D.size() + _data3D.size(); }
+
+        /**
+         * @brief Get two-dimensional primitive
+         * @param generator     Generator function
+         * @param arguments     Generator arguments
+         *
+         * If the primitive is not in the cache yet, calls @p generator with
+         * given arguments and saves the result.
+         */
+        template<class ...Args, class ...Values> const Trade::MeshData2D& get(Trade::MeshData2D(*generator)(Args...), Values&&... arguments) {
+            return get<Trade::MeshData2D, Args...>(_data2D, generator, std::forward<Values>(arguments)...);
+        }
+
+        /**
+         * @brief Get three-dimensional primitive
+         * @param generator     Generator function
+         * @param arguments     Generator arguments
+         *
+         * If the primitive is not in the cache yet, calls @p generator with
+         * given arguments and saves the result.
+         */
+        template<class ...Args, class ...Values> const Trade::MeshData3D& get(Trade::MeshData3D(*generator)(Args...), Values&&... arguments) {
+            return get<Trade::MeshData3D, Args...>(_data3D, generator, std::forward<Values>(arguments)...);
+        }
+
+        /**
+         * @brief Clear the cache
+         *
+         * Deletes all cached data, references returned from get() are
+         * invalid afterwards.
+         */
+        void clear();
+
+    private:
+        template<class T, class ...Args, class ...Values> const T& get(std::unordered_map<std::string, T*>& data, T(*generator)(Args...), Values&&... arguments) {
+            /* Key is made of function pointer and raw data of all arguments
+               converted to type which the generator expects */
+            std::string key(reinterpret_cast<const char*>(&generator), sizeof(generator));
+            const int dummy[]{0, (appendKey<typename std::decay<Args>::type>(key, arguments), 0)...};
+            static_cast<void>(dummy);
+
+            auto it = data.find(key);
+            if(it == data.end())
+                it = data.insert(std::make_pair(std::move(key), new T(generator(std::forward<Values>(arguments)...)))).first;
+            return *it->second;
+        }
+
+        template<class T> inline static void appendKey(std::string& key, const T& value) {
+            static_assert(std::is_scalar<T>::value, "Primitives::Cache: only scalar generator arguments are supported");
+            key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        std::unordered_map<std::string, Trade::MeshData2D*> _data2D;
+        std::unordered_map<std::string, Trade::MeshData3D*> _data3D;
+};
+
+}}
+
+#endif
@@ -24,99 +24,129 @@
 
 #include "Cube.h"
 
+#include <iterator>
+
 #include "Math/Vector3.h"
 #include "Trade/MeshData3D.h"
 
 namespace Magnum { namespace Primitives {
 
+/* GCC < 4.7 doesn't like constexpr here */
+#ifdef CORRADE_GCC46_COMPATIBILITY
+#define constexpr const
+#endif
+
+namespace {
+
+constexpr UnsignedInt solidIndices[]{
+     0,  1,  2,  0,  2,  3, /* +Z */
+     4,  5,  6,  4,  6,  7, /* +X */
+     8,  9, 10,  8, 10, 11, /* +Y */
+    12, 13, 14, 12, 14, 15, /* -Z */
+    16, 17, 18, 16, 18, 19, /* -Y */
+    20, 21, 22, 20, 22, 23  /* -X */
+};
+
+constexpr Vector3 solidPositions[]{
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f}, /* +Z */
+    {-1.0f,  1.0f,  1.0f},
+
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f}, /* +X */
+    { 1.0f,  1.0f,  1.0f},
+
+    {-1.0f,  1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f},
+    { 1.0f,  1.0f, -1.0f}, /* +Y */
+    {-1.0f,  1.0f, -1.0f},
+
+    { 1.0f, -1.0f, -1.0f},
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f}, /* -Z */
+    { 1.0f,  1.0f, -1.0f},
+
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f,  1.0f}, /* -Y */
+    {-1.0f, -1.0f,  1.0f},
+
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, -1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f}, /* -X */
+    {-1.0f,  1.0f, -1.0f}
+};
+
+constexpr Vector3 solidNormals[]{
+    { 0.0f,  0.0f,  1.0f},
+    { 0.0f,  0.0f,  1.0f},
+    { 0.0f,  0.0f,  1.0f}, /* +Z */
+    { 0.0f,  0.0f,  1.0f},
+
+    { 1.0f,  0.0f,  0.0f},
+    { 1.0f,  0.0f,  0.0f},
+    { 1.0f,  0.0f,  0.0f}, /* +X */
+    { 1.0f,  0.0f,  0.0f},
+
+    { 0.0f,  1.0f,  0.0f},
+    { 0.0f,  1.0f,  0.0f},
+    { 0.0f,  1.0f,  0.0f}, /* +Y */
+    { 0.0f,  1.0f,  0.0f},
+
+    { 0.0f,  0.0f, -1.0f},
+    { 0.0f,  0.0f, -1.0f},
+    { 0.0f,  0.0f, -1.0f}, /* -Z */
+    { 0.0f,  0.0f, -1.0f},
+
+    { 0.0f, -1.0f,  0.0f},
+    { 0.0f, -1.0f,  0.0f},
+    { 0.0f, -1.0f,  0.0f}, /* -Y */
+    { 0.0f, -1.0f,  0.0f},
+
+    {-1.0f,  0.0f,  0.0f},
+    {-1.0f,  0.0f,  0.0f},
+    {-1.0f,  0.0f,  0.0f}, /* -X */
+    {-1.0f,  0.0f,  0.0f}
+};
+
+constexpr UnsignedInt wireframeIndices[]{
+    0, 1, 1, 2, 2, 3, 3, 0, /* +Z */
+    4, 5, 5, 6, 6, 7, 7, 4, /* -Z */
+    1, 5, 2, 6,             /* +X */
+    0, 4, 3, 7              /* -X */
+};
+
+constexpr Vector3 wireframePositions[]{
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f},
+
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f}
+};
+
+}
+
+#ifdef CORRADE_GCC46_COMPATIBILITY
+#undef constexpr
+#endif
+
 Trade::MeshData3D Cube::solid() {
-    return Trade::MeshData3D(Mesh::Primitive::Triangles, new std::vector<UnsignedInt>{
-         0,  1,  2,  0,  2,  3, /* +Z */
-         4,  5,  6,  4,  6,  7, /* +X */
-         8,  9, 10,  8, 10, 11, /* +Y */
-        12, 13, 14, 12, 14, 15, /* -Z */
-        16, 17, 18, 16, 18, 19, /* -Y */
-        20, 21, 22, 20, 22, 23  /* -X */
-    }, {new std::vector<Vector3>{
-        {-1.0f, -1.0f,  1.0f},
-        { 1.0f, -1.0f,  1.0f},
-        { 1.0f,  1.0f,  1.0f}, /* +Z */
-        {-1.0f,  1.0f,  1.0f},
-
-        { 1.0f, -1.0f,  1.0f},
-        { 1.0f, -1.0f, -1.0f},
-        { 1.0f,  1.0f, -1.0f}, /* +X */
-        { 1.0f,  1.0f,  1.0f},
-
-        {-1.0f,  1.0f,  1.0f},
-        { 1.0f,  1.0f,  1.0f},
-        { 1.0f,  1.0f, -1.0f}, /* +Y */
-        {-1.0f,  1.0f, -1.0f},
-
-        { 1.0f, -1.0f, -1.0f},
-        {-1.0f, -1.0f, -1.0f},
-        {-1.0f,  1.0f, -1.0f}, /* -Z */
-        { 1.0f,  1.0f, -1.0f},
-
-        {-1.0f, -1.0f, -1.0f},
-        { 1.0f, -1.0f, -1.0f},
-        { 1.0f, -1.0f,  1.0f}, /* -Y */
-        {-1.0f, -1.0f,  1.0f},
-
-        {-1.0f, -1.0f, -1.0f},
-        {-1.0f, -1.0f,  1.0f},
-        {-1.0f,  1.0f,  1.0f}, /* -X */
-        {-1.0f,  1.0f, -1.0f}
-    }}, {new std::vector<Vector3>{
-        { 0.0f,  0.0f,  1.0f},
-        { 0.0f,  0.0f,  1.0f},
-        { 0.0f,  0.0f,  1.0f}, /* +Z */
-        { 0.0f,  0.0f,  1.0f},
-
-        { 1.0f,  0.0f,  0.0f},
-        { 1.0f,  0.0f,  0.0f},
-        { 1.0f,  0.0f,  0.0f}, /* +X */
-        { 1.0f,  0.0f,  0.0f},
-
-        { 0.0f,  1.0f,  0.0f},
-        { 0.0f,  1.0f,  0.0f},
-        { 0.0f,  1.0f,  0.0f}, /* +Y */
-        { 0.0f,  1.0f,  0.0f},
-
-        { 0.0f,  0.0f, -1.0f},
-        { 0.0f,  0.0f, -1.0f},
-        { 0.0f,  0.0f, -1.0f}, /* -Z */
-        { 0.0f,  0.0f, -1.0f},
-
-        { 0.0f, -1.0f,  0.0f},
-        { 0.0f, -1.0f,  0.0f},
-        { 0.0f, -1.0f,  0.0f}, /* -Y */
-        { 0.0f, -1.0f,  0.0f},
-
-        {-1.0f,  0.0f,  0.0f},
-        {-1.0f,  0.0f,  0.0f},
-        {-1.0f,  0.0f,  0.0f}, /* -X */
-        {-1.0f,  0.0f,  0.0f}
-    }}, {});
+    return Trade::MeshData3D(Mesh::Primitive::Triangles,
+        new std::vector<UnsignedInt>(std::begin(solidIndices), std::end(solidIndices)),
+        {new std::vector<Vector3>(std::begin(solidPositions), std::end(solidPositions))},
+        {new std::vector<Vector3>(std::begin(solidNormals), std::end(solidNormals))}, {});
 }
 
 Trade::MeshData3D Cube::wireframe() {
-    return Trade::MeshData3D(Mesh::Primitive::Lines, new std::vector<UnsignedInt>{
-        0, 1, 1, 2, 2, 3, 3, 0, /* +Z */
-        4, 5, 5, 6, 6, 7, 7, 4, /* -Z */
-        1, 5, 2, 6,             /* +X */
-        0, 4, 3, 7              /* -X */
-    }, {new std::vector<Vector3>{
-        {-1.0f, -1.0f,  1.0f},
-        { 1.0f, -1.0f,  1.0f},
-        { 1.0f,  1.0f,  1.0f},
-        {-1.0f,  1.0f,  1.0f},
-
-        {-1.0f, -1.0f, -1.0f},
-        { 1.0f, -1.0f, -1.0f},
-        { 1.0f,  1.0f, -1.0f},
-        {-1.0f,  1.0f, -1.0f}
-    }}, {}, {});
+    return Trade::MeshData3D(Mesh::Primitive::Lines,
+        new std::vector<UnsignedInt>(std::begin(wireframeIndices), std::end(wireframeIndices)),
+        {new std::vector<Vector3>(std::begin(wireframePositions), std::end(wireframePositions))}, {}, {});
 }
 
 }}
@@ -24,11 +24,21 @@
 
 #include "Icosphere.h"
 
+#include <iterator>
+
 #include "Math/Vector3.h"
+#include "MeshTools/Subdivide.h"
 
 namespace Magnum { namespace Primitives {
 
-Icosphere<0>::Icosphere(): MeshData3D(Mesh::Primitive::Triangles, new std::vector<UnsignedInt>{
+/* GCC < 4.7 doesn't like constexpr here */
+#ifdef CORRADE_GCC46_COMPATIBILITY
+#define constexpr const
+#endif
+
+namespace {
+
+constexpr UnsignedInt icosphereIndices[]{
     1, 2, 6,
     1, 7, 2,
     3, 4, 5,
@@ -49,7 +59,10 @@ Icosphere<0>::Icosphere(): MeshData3D(Mesh::Primitive::Triangles, new std::vecto
     7, 1, 0,
     3, 9, 8,
     4, 8, 0
-}, {new std::vector<Vector3>}, {new std::vector<Vector3>{
+};
+
+/* Positions are the same as normals */
+constexpr Vector3 icosphereNormals[]{
     {0.0f, -0.525731f, 0.850651f},
     {0.850651f, 0.0f, 0.525731f},
     {0.850651f, 0.0f, -0.525731f},
@@ -62,8 +75,24 @@ Icosphere<0>::Icosphere(): MeshData3D(Mesh::Primitive::Triangles, new std::vecto
     {0.0f, -0.525731f, -0.850651f},
     {0.0f, 0.525731f, -0.850651f},
     {0.0f, 0.525731f, 0.850651f}
-}}, {}) {
-    positions(0)->assign(normals(0)->begin(), normals(0)->end());
+};
+
+}
+
+#ifdef CORRADE_GCC46_COMPATIBILITY
+#undef constexpr
+#endif
+
+Trade::MeshData3D Icosphere<0>::solid(const UnsignedInt subdivisions) {
+    std::vector<UnsignedInt>* indices = new std::vector<UnsignedInt>(std::begin(icosphereIndices), std::end(icosphereIndices));
+    std::vector<Vector3>* normals = new std::vector<Vector3>(std::begin(icosphereNormals), std::end(icosphereNormals));
+    for(UnsignedInt i = 0; i != subdivisions; ++i)
+        MeshTools::subdivide(*indices, *normals, [](const Vector3& a, const Vector3& b) {
+            return (a+b).normalized();
+        });
+
+    /* Positions are the same as normals */
+    return Trade::MeshData3D(Mesh::Primitive::Triangles, indices, {new std::vector<Vector3>(*normals)}, {normals}, {});
 }
 
 }}
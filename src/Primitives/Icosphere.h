@@ -28,9 +28,6 @@
  * @brief Class Magnum::Primitives::Icosphere
  */
 
-#include "Math/Vector3.h"
-#include "MeshTools/Subdivide.h"
-#include "MeshTools/Clean.h"
 #include "Trade/MeshData3D.h"
 
 #include "Primitives/magnumPrimitivesVisibility.h"
@@ -47,10 +44,29 @@ template<std::size_t subdivisions> class MAGNUM_PRIMITIVES_EXPORT Icosphere;
 
 Indexed @ref Mesh::Primitive "Triangles" with normals.
 */
-template<> class Icosphere<0>: public Trade::MeshData3D {
+template<> class MAGNUM_PRIMITIVES_EXPORT Icosphere<0>: public Trade::MeshData3D {
     public:
+        /**
+         * @brief Solid icosphere
+         * @param subdivisions  Number of subdivisions
+         *
+         * Indexed @ref Mesh::Primitive "Triangles" with normals. Same as
+         * constructing Icosphere with given template parameter, but the
+         * subdivision count can be specified at runtime and the function
+         * can be used with Cache:
+         * @code
+         * const Trade::MeshData3D& sphere = cache.get(Primitives::Icosphere<0>::solid, 3);
+         * @endcode
+         */
+        static Trade::MeshData3D solid(UnsignedInt subdivisions);
+
         /** @brief Constructor */
-        explicit Icosphere();
+        inline explicit Icosphere(): Trade::MeshData3D(solid(0)) {}
+
+    protected:
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        inline explicit Icosphere(Trade::MeshData3D&& data): Trade::MeshData3D(std::move(data)) {}
+        #endif
 };
 
 /**
@@ -65,16 +81,12 @@ template<std::size_t subdivisions> class Icosphere: public Icosphere<0> {
 template<std::size_t subdivisions> class Icosphere {
 #endif
     public:
-        /** @brief Constructor */
-        explicit Icosphere() {
-            for(std::size_t i = 0; i != subdivisions; ++i)
-                MeshTools::subdivide(*indices(), *normals(0), [](const Vector3& a, const Vector3& b) {
-                    return (a+b).normalized();
-                });
-
-            MeshTools::clean(*indices(), *normals(0));
-            positions(0)->assign(normals(0)->begin(), normals(0)->end());
-        }
+        /**
+         * @brief Constructor
+         *
+         * @see Icosphere<0>::solid()
+         */
+        inline explicit Icosphere(): Icosphere<0>(Icosphere<0>::solid(subdivisions)) {}
 };
 
 }}
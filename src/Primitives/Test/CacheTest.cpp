@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <TestSuite/Tester.h>
+
+#include "Math/Vector3.h"
+#include "Primitives/Cache.h"
+#include "Primitives/Circle.h"
+#include "Primitives/Cube.h"
+#include "Primitives/Icosphere.h"
+#include "Primitives/UVSphere.h"
+
+namespace Magnum { namespace Primitives { namespace Test {
+
+class CacheTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit CacheTest();
+
+        void get();
+        void differentArguments();
+        void icosphere();
+        void clear();
+};
+
+CacheTest::CacheTest() {
+    addTests({&CacheTest::get,
+              &CacheTest::differentArguments,
+              &CacheTest::icosphere,
+              &CacheTest::clear});
+}
+
+void CacheTest::get() {
+    Cache cache;
+
+    const Trade::MeshData3D& cube = cache.get(Primitives::Cube::solid);
+    const Trade::MeshData3D& cube2 = cache.get(Primitives::Cube::solid);
+    const Trade::MeshData2D& circle = cache.get(Primitives::Circle::wireframe, 8);
+    const Trade::MeshData2D& circle2 = cache.get(Primitives::Circle::wireframe, 8u);
+
+    /* The data are generated only once */
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(&cube, &cube2);
+    CORRADE_COMPARE(&circle, &circle2);
+    CORRADE_COMPARE(cube.positions(0)->size(), 24);
+    CORRADE_COMPARE(circle.positions(0)->size(), 8);
+}
+
+void CacheTest::differentArguments() {
+    Cache cache;
+
+    const Trade::MeshData3D& wireframe = cache.get(Primitives::Cube::wireframe);
+    const Trade::MeshData3D& solid = cache.get(Primitives::Cube::solid);
+    const Trade::MeshData3D& sphere = cache.get(Primitives::UVSphere::solid, 3, 3, Primitives::UVSphere::TextureCoords::DontGenerate);
+    const Trade::MeshData3D& sphereTextured = cache.get(Primitives::UVSphere::solid, 3, 3, Primitives::UVSphere::TextureCoords::Generate);
+    const Trade::MeshData3D& sphereMoreRings = cache.get(Primitives::UVSphere::solid, 4, 3, Primitives::UVSphere::TextureCoords::DontGenerate);
+
+    CORRADE_COMPARE(cache.count(), 5);
+    CORRADE_VERIFY(&wireframe != &solid);
+    CORRADE_COMPARE(sphere.textureCoords2DArrayCount(), 0);
+    CORRADE_COMPARE(sphereTextured.textureCoords2DArrayCount(), 1);
+    CORRADE_VERIFY(sphereMoreRings.positions(0)->size() > sphere.positions(0)->size());
+}
+
+void CacheTest::icosphere() {
+    Cache cache;
+
+    const Trade::MeshData3D& sphere = cache.get(Primitives::Icosphere<0>::solid, 2);
+    const Trade::MeshData3D& sphere2 = cache.get(Primitives::Icosphere<0>::solid, 2u);
+    const Trade::MeshData3D& sphereLessSubdivided = cache.get(Primitives::Icosphere<0>::solid, 1);
+
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(&sphere, &sphere2);
+    CORRADE_VERIFY(&sphere != &sphereLessSubdivided);
+
+    /* Same data as the compile-time variant */
+    Icosphere<2> original;
+    CORRADE_COMPARE(*sphere.indices(), *original.indices());
+    CORRADE_COMPARE(*sphere.positions(0), *original.positions(0));
+    CORRADE_COMPARE(*sphere.normals(0), *original.normals(0));
+}
+
+void CacheTest::clear() {
+    Cache cache;
+    cache.get(Primitives::Cube::solid);
+    cache.get(Primitives::Circle::wireframe, 8);
+    CORRADE_COMPARE(cache.count(), 2);
+
+    cache.clear();
+    CORRADE_COMPARE(cache.count(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Primitives::Test::CacheTest)
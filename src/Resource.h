@@ -127,44 +127,48 @@ class Resource {
          * Creates empty resource. Resources are acquired from the manager by
          * calling ResourceManager::get().
          */
-        inline explicit Resource(): manager(nullptr), lastCheck(0), _state(ResourceState::Final), data(nullptr) {}
+        inline explicit Resource(): manager(nullptr), entry(nullptr), generation(0), fallbackGeneration(0), _state(ResourceState::Final), data(nullptr) {}
 
         /** @brief Copy constructor */
-        inline Resource(const Resource<T, U>& other): manager(other.manager), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
-            if(manager) manager->incrementReferenceCount(_key);
+        inline Resource(const Resource<T, U>& other): manager(other.manager), entry(other.entry), _key(other._key), generation(other.generation), fallbackGeneration(other.fallbackGeneration), _state(other._state), data(other.data) {
+            if(manager) manager->incrementReferenceCount(entry);
         }
 
         /** @brief Move constructor */
-        inline Resource(Resource<T, U>&& other): manager(other.manager), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
+        inline Resource(Resource<T, U>&& other): manager(other.manager), entry(other.entry), _key(other._key), generation(other.generation), fallbackGeneration(other.fallbackGeneration), _state(other._state), data(other.data) {
             other.manager = nullptr;
         }
 
         /** @brief Destructor */
         inline ~Resource() {
-            if(manager) manager->decrementReferenceCount(_key);
+            if(manager) manager->decrementReferenceCount(_key, entry);
         }
 
         /** @brief Assignment operator */
         Resource<T, U>& operator=(const Resource<T, U>& other) {
-            if(manager) manager->decrementReferenceCount(_key);
+            if(manager) manager->decrementReferenceCount(_key, entry);
 
             manager = other.manager;
+            entry = other.entry;
             _key = other._key;
-            lastCheck = other.lastCheck;
+            generation = other.generation;
+            fallbackGeneration = other.fallbackGeneration;
             _state = other._state;
             data = other.data;
 
-            if(manager) manager->incrementReferenceCount(_key);
+            if(manager) manager->incrementReferenceCount(entry);
             return *this;
         }
 
         /** @brief Assignment move operator */
         Resource<T, U>& operator=(Resource<T, U>&& other) {
-            if(manager) manager->decrementReferenceCount(_key);
+            if(manager) manager->decrementReferenceCount(_key, entry);
 
             manager = other.manager;
+            entry = other.entry;
             _key = other._key;
-            lastCheck = other.lastCheck;
+            generation = other.generation;
+            fallbackGeneration = other.fallbackGeneration;
             _state = other._state;
             data = other.data;
 
@@ -225,20 +229,23 @@ class Resource {
         }
 
     private:
-        inline Resource(Implementation::ResourceManagerData<T>* manager, ResourceKey key): manager(manager), _key(key), lastCheck(0), _state(ResourceState::NotLoaded), data(nullptr) {
-            manager->incrementReferenceCount(key);
-        }
+        /* The reference is already counted by the manager */
+        inline Resource(Implementation::ResourceManagerData<T>* manager, ResourceKey key, typename Implementation::ResourceManagerData<T>::Data* entry): manager(manager), entry(entry), _key(key), generation(0), fallbackGeneration(0), _state(ResourceState::NotLoaded), data(nullptr) {}
 
         void acquire() {
             /* The data are already final, nothing to do */
             if(_state == ResourceState::Final) return;
 
-            /* Nothing changed since last check */
-            if(manager->lastChange() < lastCheck) return;
+            /* Nothing changed since last check, neither the data nor the
+               fallback */
+            const typename Implementation::ResourceManagerData<T>::Data& d = *entry;
+            const std::size_t currentGeneration = d.generation;
+            const std::size_t currentFallbackGeneration = manager->fallbackGeneration();
+            if(currentGeneration == generation && currentFallbackGeneration == fallbackGeneration) return;
 
-            /* Acquire new data and save last check time */
-            const typename Implementation::ResourceManagerData<T>::Data& d = manager->data(_key);
-            lastCheck = manager->lastChange();
+            /* Acquire new data and save the generations */
+            generation = currentGeneration;
+            fallbackGeneration = currentFallbackGeneration;
 
             /* Try to get the data */
             data = d.data;
@@ -261,8 +268,9 @@ class Resource {
         }
 
         Implementation::ResourceManagerData<T>* manager;
+        typename Implementation::ResourceManagerData<T>::Data* entry;
         ResourceKey _key;
-        std::size_t lastCheck;
+        std::size_t generation, fallbackGeneration;
         ResourceState _state;
         T* data;
 };
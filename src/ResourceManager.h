@@ -28,7 +28,12 @@
  * @brief Class Magnum::ResourceManager, enum Magnum::ResourceDataState, Magnum::ResourcePolicy
  */
 
+#include <atomic>
+#include <limits>
+#include <list>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "Resource.h"
 
@@ -84,7 +89,59 @@ enum class ResourcePolicy: UnsignedByte {
     Manual,
 
     /** The resource will be unloaded when last reference to it is gone. */
-    ReferenceCounted
+    ReferenceCounted,
+
+    /**
+     * The resource will be kept after last reference to it is gone, but it
+     * will be unloaded when memory used by resources of given type exceeds
+     * the budget, least recently used first. It can be also unloaded by
+     * calling ResourceManager::free().
+     * @see ResourceManager::setBudget(), ResourceTraits
+     */
+    Cached
+};
+
+/** @relates ResourceManager
+@brief %Resource traits
+
+Size of the resource data for memory budget. Default implementation returns
+`sizeof(T)`, specialize it for types which own additional memory, e.g.:
+@code
+namespace Magnum {
+    template<> struct ResourceTraits<Trade::ImageData2D> {
+        static std::size_t size(const Trade::ImageData2D& image) {
+            return image.pixelSize()*image.size().product();
+        }
+    };
+}
+@endcode
+@see ResourceManager::setBudget(), ResourcePolicy
+*/
+template<class T> struct ResourceTraits {
+    /** @brief Size of given resource data in bytes */
+    static std::size_t size(const T&) { return sizeof(T); }
+};
+
+/** @relates ResourceManager
+@brief %Resource statistics
+
+@see ResourceManager::statistics()
+*/
+struct ResourceStatistics {
+    /** @brief Count of ResourceManager::get() calls for loaded resources */
+    std::size_t hits;
+
+    /** @brief Count of ResourceManager::get() calls for not loaded resources */
+    std::size_t misses;
+
+    /** @brief Count of resources unloaded because of the budget */
+    std::size_t evictions;
+
+    /** @brief Total size of resources unloaded because of the budget */
+    std::size_t evictedBytes;
+
+    /** @brief Total size of currently present resources */
+    std::size_t usedBytes;
 };
 
 template<class> class AbstractResourceLoader;
@@ -115,32 +172,53 @@ namespace Implementation {
                 }
             }
 
-            inline std::size_t lastChange() const { return _lastChange; }
+            std::size_t count() const {
+                std::size_t count = 0;
+                for(const Shard& shard: _shards) {
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    count += shard.data.size();
+                }
+                return count;
+            }
+
+            inline std::size_t budget() const { return _budget; }
+
+            void setBudget(std::size_t budget) {
+                _budget = budget;
+                evict();
+            }
 
-            inline std::size_t count() const { return _data.size(); }
+            ResourceStatistics statistics() const {
+                std::lock_guard<std::mutex> lock(_cacheMutex);
+                return {_hits, _misses, _evictions, _evictedBytes, _usedBytes};
+            }
 
             std::size_t referenceCount(ResourceKey key) const {
-                auto it = _data.find(key);
-                if(it == _data.end()) return 0;
+                const Shard& s = shard(key);
+                std::lock_guard<std::mutex> lock(s.mutex);
+                auto it = s.data.find(key);
+                if(it == s.data.end()) return 0;
                 return it->second.referenceCount;
             }
 
             ResourceState state(ResourceKey key) const {
-                auto it = _data.find(key);
+                const Shard& s = shard(key);
+                std::lock_guard<std::mutex> lock(s.mutex);
+                auto it = s.data.find(key);
 
                 /* Resource not loaded */
-                if(it == _data.end() || !it->second.data) {
+                if(it == s.data.end() || !it->second.data) {
                     /* Fallback found, add *Fallback to state */
                     if(_fallback) {
-                        if(it != _data.end() && it->second.state == ResourceDataState::Loading)
+                        if(it != s.data.end() && it->second.state == ResourceDataState::Loading)
                             return ResourceState::LoadingFallback;
-                        else if(it != _data.end() && it->second.state == ResourceDataState::NotFound)
+                        else if(it != s.data.end() && it->second.state == ResourceDataState::NotFound)
                             return ResourceState::NotFoundFallback;
                         else return ResourceState::NotLoadedFallback;
                     }
 
                     /* Fallback not found, loading didn't start yet */
-                    if(it == _data.end() || (it->second.state != ResourceDataState::Loading && it->second.state != ResourceDataState::NotFound))
+                    if(it == s.data.end() || (it->second.state != ResourceDataState::Loading && it->second.state != ResourceDataState::NotFound))
                         return ResourceState::NotLoaded;
                 }
 
@@ -148,47 +226,52 @@ namespace Implementation {
                 return static_cast<ResourceState>(it->second.state);
             }
 
-            template<class U> inline Resource<T, U> get(ResourceKey key) {
-                /* Ask loader for the data, if they aren't there yet */
-                if(_loader && _data.find(key) == _data.end())
-                    _loader->load(key);
-
-                return Resource<T, U>(this, key);
-            }
-
-            void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
-                auto it = _data.find(key);
-
-                /* NotFound / Loading state shouldn't have any data */
-                CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound || state == ResourceDataState::Loading),
-                    "ResourceManager::set(): data should be null if and only if state is NotFound or Loading", );
-
-                /* Cannot change resource with already final state */
-                CORRADE_ASSERT(it == _data.end() || it->second.state != ResourceDataState::Final,
-                    "ResourceManager::set(): cannot change already final resource" << key, );
+            template<class U> Resource<T, U> get(ResourceKey key) {
+                Shard& s = shard(key);
+                Data* entry;
+                bool load;
+                {
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    auto it = s.data.find(key);
+
+                    /* Only the thread which added the entry asks the loader */
+                    load = _loader && it == s.data.end();
+                    if(it == s.data.end())
+                        it = s.data.insert(std::make_pair(key, Data())).first;
+
+                    entry = &it->second;
+                    ++(entry->data ? _hits : _misses);
+
+                    /* Cached resource is referenced again, it can't be
+                       evicted anymore */
+                    if(entry->cached) {
+                        std::lock_guard<std::mutex> lock(_cacheMutex);
+                        _lru.erase(entry->lruPosition);
+                        entry->cached = false;
+                    }
 
-                /* If nothing is referencing reference-counted resource, we're done */
-                if(policy == ResourcePolicy::ReferenceCounted && (it == _data.end() || it->second.referenceCount == 0)) {
-                    Corrade::Utility::Warning() << "ResourceManager: Reference-counted resource with key" << key << "isn't referenced from anywhere, deleting it immediately";
-                    delete data;
+                    ++entry->referenceCount;
+                }
 
-                    /* Delete also already present resource (it could be here
-                       because previous policy could be other than
-                       ReferenceCounted) */
-                    if(it != _data.end()) _data.erase(it);
+                /* Ask loader for the data, if they aren't there yet. The
+                   loader calls set(), so it can't be done while locked. */
+                if(load) _loader->load(key);
 
-                    return;
+                return Resource<T, U>(this, key, entry);
+            }
 
-                /* Insert it, if not already here */
-                } else if(it == _data.end())
-                    it = _data.insert(std::make_pair(key, Data())).first;
+            void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
+                std::vector<T*> garbage;
+                {
+                    Shard& s = shard(key);
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    setInternal(s, key, data, state, policy, garbage);
+                }
 
-                /* Replace previous data */
-                delete it->second.data;
-                it->second.data = data;
-                it->second.state = state;
-                it->second.policy = policy;
-                ++_lastChange;
+                /* Not inside the lock, as the destructors might release
+                   other resources and eviction locks other shards */
+                deleteAll(garbage);
+                evict();
             }
 
             inline T* fallback() { return _fallback; }
@@ -197,14 +280,28 @@ namespace Implementation {
             inline void setFallback(T* data) {
                 delete _fallback;
                 _fallback = data;
+                ++_fallbackGeneration;
             }
 
+            /* Incremented on every fallback change, so Resource instances
+               don't keep pointer to deleted fallback */
+            inline std::size_t fallbackGeneration() const { return _fallbackGeneration; }
+
             void free() {
                 /* Delete all non-referenced non-resident resources */
-                for(auto it = _data.begin(); it != _data.end(); ) {
-                    if(it->second.policy != ResourcePolicy::Resident && !it->second.referenceCount)
-                        it = _data.erase(it);
-                    else ++it;
+                std::vector<T*> garbage;
+                for(Shard& shard: _shards) {
+                    {
+                        std::lock_guard<std::mutex> lock(shard.mutex);
+                        for(auto it = shard.data.begin(); it != shard.data.end(); ) {
+                            if(it->second.policy != ResourcePolicy::Resident && !it->second.referenceCount)
+                                it = erase(shard, it, garbage);
+                            else ++it;
+                        }
+                    }
+
+                    deleteAll(garbage);
+                    garbage.clear();
                 }
             }
 
@@ -221,17 +318,93 @@ namespace Implementation {
             }
 
         protected:
-            inline ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0) {}
+            inline ResourceManagerData(): _fallback(nullptr), _fallbackGeneration(0), _loader(nullptr), _budget(std::numeric_limits<std::size_t>::max()), _hits(0), _misses(0), _evictions(0), _evictedBytes(0), _usedBytes(0) {}
 
         private:
+            struct Shard;
+
+            /* Called by the loader, resets the resource to not loaded state
+               if it is still loading */
+            void cancelLoading(ResourceKey key) {
+                Shard& s = shard(key);
+                std::lock_guard<std::mutex> lock(s.mutex);
+                auto it = s.data.find(key);
+                if(it == s.data.end() || it->second.state != ResourceDataState::Loading) return;
+
+                /* Loading resource has no data, nothing to delete */
+                std::vector<T*> garbage;
+                if(!it->second.referenceCount) erase(s, it, garbage);
+                else {
+                    it->second.state = ResourceDataState::Mutable;
+                    ++it->second.generation;
+                }
+            }
+
+            /* Expects the shard to be locked. Data to be deleted are put into
+               @p garbage, the caller deletes them after unlocking. */
+            void setInternal(Shard& s, ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::vector<T*>& garbage) {
+                auto it = s.data.find(key);
+
+                /* NotFound / Loading state shouldn't have any data */
+                CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound || state == ResourceDataState::Loading),
+                    "ResourceManager::set(): data should be null if and only if state is NotFound or Loading", );
+
+                /* Cannot change resource with already final state */
+                CORRADE_ASSERT(it == s.data.end() || it->second.state != ResourceDataState::Final,
+                    "ResourceManager::set(): cannot change already final resource" << key, );
+
+                /* If nothing is referencing reference-counted resource, we're done */
+                if(policy == ResourcePolicy::ReferenceCounted && (it == s.data.end() || it->second.referenceCount == 0)) {
+                    Corrade::Utility::Warning() << "ResourceManager: Reference-counted resource with key" << key << "isn't referenced from anywhere, deleting it immediately";
+                    garbage.push_back(data);
+
+                    /* Delete also already present resource (it could be here
+                       because previous policy could be other than
+                       ReferenceCounted) */
+                    if(it != s.data.end()) erase(s, it, garbage);
+
+                    return;
+
+                /* Insert it, if not already here */
+                } else if(it == s.data.end())
+                    it = s.data.insert(std::make_pair(key, Data())).first;
+
+                /* Replace previous data */
+                Data& d = it->second;
+                const std::size_t size = data ? ResourceTraits<T>::size(*data) : 0;
+                {
+                    std::lock_guard<std::mutex> lock(_cacheMutex);
+                    _usedBytes = _usedBytes - d.size + size;
+
+                    /* Put unreferenced cached resource to the end of LRU
+                       queue, or remove it from there if the policy changed */
+                    if(d.cached) _lru.erase(d.lruPosition);
+                    if((d.cached = policy == ResourcePolicy::Cached && !d.referenceCount))
+                        d.lruPosition = _lru.insert(_lru.end(), key);
+                }
+
+                if(d.data) garbage.push_back(d.data);
+                d.data = data;
+                d.size = size;
+                d.state = state;
+                d.policy = policy;
+                ++d.generation;
+            }
+
+            /* Count of independently locked parts of the storage */
+            enum: std::size_t {
+                ShardBits = 4,
+                ShardCount = 1 << ShardBits
+            };
+
             struct Data {
                 Data(const Data&) = delete;
                 Data& operator=(const Data&) = delete;
                 Data& operator=(Data&&) = delete;
 
-                inline Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0) {}
+                inline Data(): data(nullptr), size(0), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), cached(false), referenceCount(0), generation(1) {}
 
-                inline Data(Data&& other): data(other.data), state(other.state), policy(other.policy), referenceCount(other.referenceCount) {
+                inline Data(Data&& other): data(other.data), size(other.size), state(other.state), policy(other.policy), cached(other.cached), lruPosition(other.lruPosition), referenceCount(other.referenceCount.load()), generation(other.generation.load()) {
                     other.data = nullptr;
                     other.referenceCount = 0;
                 }
@@ -243,31 +416,137 @@ namespace Implementation {
                 }
 
                 T* data;
+                std::size_t size;
                 ResourceDataState state;
                 ResourcePolicy policy;
-                std::size_t referenceCount;
+
+                /* Whether the resource is in LRU queue, i.e. it can be
+                   evicted */
+                bool cached;
+                std::list<ResourceKey>::iterator lruPosition;
+
+                std::atomic<std::size_t> referenceCount;
+
+                /* Incremented on every change, Resource instances compare it
+                   to the value they saw last time. Zero is never used. */
+                std::atomic<std::size_t> generation;
             };
 
-            inline const Data& data(ResourceKey key) {
-                return _data[key];
+            struct Shard {
+                mutable std::mutex mutex;
+                std::unordered_map<ResourceKey, Data, ResourceKeyHash> data;
+            };
+
+            /* Taking the top bits, as the bottom ones are used for selecting
+               bucket in the hash map */
+            inline Shard& shard(ResourceKey key) {
+                return _shards[ResourceKeyHash()(key) >> (sizeof(std::size_t)*8 - ShardBits)];
+            }
+            inline const Shard& shard(ResourceKey key) const {
+                return _shards[ResourceKeyHash()(key) >> (sizeof(std::size_t)*8 - ShardBits)];
+            }
+
+            /* The entry stays at the same place in memory as long as it is
+               referenced, so copying the references doesn't need any lookup */
+            inline void incrementReferenceCount(Data* entry) {
+                ++entry->referenceCount;
+            }
+
+            void decrementReferenceCount(ResourceKey key, Data* entry) {
+                if(--entry->referenceCount) return;
+
+                /* Free the resource if it is reference counted or make it
+                   available for eviction if it is cached. Another thread
+                   might have referenced it again or freed it in the
+                   meantime. */
+                std::vector<T*> garbage;
+                {
+                    Shard& s = shard(key);
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    auto it = s.data.find(key);
+                    if(it == s.data.end() || &it->second != entry || entry->referenceCount || entry->cached) return;
+
+                    if(entry->policy == ResourcePolicy::ReferenceCounted)
+                        erase(s, it, garbage);
+
+                    else if(entry->policy == ResourcePolicy::Cached) {
+                        std::lock_guard<std::mutex> cacheLock(_cacheMutex);
+                        entry->cached = true;
+                        entry->lruPosition = _lru.insert(_lru.end(), key);
+
+                    } else return;
+                }
+
+                /* The destructor might release other resources from the same
+                   shard, so it can't be called while locked */
+                deleteAll(garbage);
+                evict();
+            }
+
+            /* Expects the shard to be locked. The data are not deleted but put
+               into @p garbage, the caller deletes them after unlocking. */
+            typename std::unordered_map<ResourceKey, Data, ResourceKeyHash>::iterator erase(Shard& s, typename std::unordered_map<ResourceKey, Data, ResourceKeyHash>::iterator it, std::vector<T*>& garbage) {
+                {
+                    std::lock_guard<std::mutex> lock(_cacheMutex);
+                    _usedBytes -= it->second.size;
+                    if(it->second.cached) _lru.erase(it->second.lruPosition);
+                }
+
+                if(it->second.data) {
+                    garbage.push_back(it->second.data);
+                    it->second.data = nullptr;
+                }
+                return s.data.erase(it);
             }
 
-            inline void incrementReferenceCount(ResourceKey key) {
-                ++_data[key].referenceCount;
+            static void deleteAll(const std::vector<T*>& garbage) {
+                for(T* data: garbage) delete data;
             }
 
-            inline void decrementReferenceCount(ResourceKey key) {
-                auto it = _data.find(key);
+            /* Evict least recently used cached resources until the used
+               memory fits into the budget */
+            void evict() {
+                for(;;) {
+                    ResourceKey key;
+                    {
+                        std::lock_guard<std::mutex> lock(_cacheMutex);
+                        if(_usedBytes <= _budget || _lru.empty()) return;
+                        key = _lru.front();
+                    }
+
+                    /* The shard must be locked before the queue, the resource
+                       might be referenced again before that */
+                    std::vector<T*> garbage;
+                    {
+                        Shard& s = shard(key);
+                        std::lock_guard<std::mutex> lock(s.mutex);
+                        auto it = s.data.find(key);
+                        if(it == s.data.end() || !it->second.cached) continue;
+
+                        {
+                            std::lock_guard<std::mutex> lock(_cacheMutex);
+                            ++_evictions;
+                            _evictedBytes += it->second.size;
+                        }
+                        erase(s, it, garbage);
+                    }
 
-                /* Free the resource if it is reference counted */
-                if(--it->second.referenceCount == 0 && it->second.policy == ResourcePolicy::ReferenceCounted)
-                    _data.erase(it);
+                    deleteAll(garbage);
+                }
             }
 
-            std::unordered_map<ResourceKey, Data, ResourceKeyHash> _data;
+            Shard _shards[ShardCount];
             T* _fallback;
+            std::atomic<std::size_t> _fallbackGeneration;
             AbstractResourceLoader<T>* _loader;
-            std::size_t _lastChange;
+
+            std::atomic<std::size_t> _budget, _hits, _misses;
+
+            /* Protects LRU queue and the statistics below. If locked together
+               with a shard, the shard must be locked first. */
+            mutable std::mutex _cacheMutex;
+            std::list<ResourceKey> _lru;
+            std::size_t _evictions, _evictedBytes, _usedBytes;
     };
 }
 
@@ -281,10 +560,12 @@ instance().
 
 Each resource is referenced from Resource class. For optimizing performance,
 each resource can be set as mutable or final. Mutable resources can be
-modified by the manager and thus each %Resource instance asks the manager for
-modifications on each access. On the other hand, final resources cannot be
-modified by the manager, so %Resource instances don't have to ask the manager
-every time, which is faster.
+modified by the manager and thus each %Resource instance checks whether the
+data changed on each access. The check is cheap, as each resource has its own
+change counter and the %Resource instance points directly to it, so changing
+one resource doesn't affect access to others. On the other hand, final
+resources cannot be modified by the manager, so %Resource instances don't
+have to check anything, which is even faster.
 
 It's possible to provide fallback for resources which are not available using
 setFallback(). Accessing data of such resources will access the fallback
@@ -292,11 +573,12 @@ instead of failing on null pointer dereference. Availability and state of each
 resource can be queried through function state() on the manager or
 Resource::state() on each resource.
 
-The resources can be managed in three ways - resident resources, which stay in
+The resources can be managed in four ways - resident resources, which stay in
 memory for whole lifetime of the manager, manually managed resources, which
-can be deleted by calling free() if nothing references them anymore, and
+can be deleted by calling free() if nothing references them anymore,
 reference counted resources, which are deleted as soon as the last reference
-to them is removed.
+to them is removed, and cached resources, which are deleted when nothing
+references them and memory budget set with setBudget() is exceeded.
 
 %Resource state and policy is configured when setting the resource data in
 set() and can be changed each time the data are updated, although already
@@ -334,6 +616,21 @@ cube->draw();
 - Destroying resource references and deleting manager instance when nothing
   references the resources anymore.
 
+@section ResourceManager-multithreading Thread safety
+
+The storage is split into independently locked parts and reference counting
+is atomic, so get(), state(), referenceCount() and creating, copying or
+destroying Resource instances can be done from multiple threads at once.
+Changing the data with set() or free() is also safe, but accessing the data
+of a resource while another thread is replacing it is not. Do the changes
+from one thread at a time when nobody else is accessing affected resources,
+or use final resources, which cannot be changed. Fallback and loader setup
+is not thread-safe.
+
+If a loader is set, get() calls AbstractResourceLoader::load() on the
+requesting thread, so the loader must be thread-safe as well. The base
+implementation and AbstractAsyncResourceLoader are.
+
 @see AbstractResourceLoader
 */
 /* Due to too much work involved with explicit template instantiation (all
@@ -446,6 +743,40 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return this;
         }
 
+        /**
+         * @brief Memory budget for given type of resources
+         *
+         * @see setBudget()
+         */
+        template<class T> inline std::size_t budget() const {
+            return this->Implementation::ResourceManagerData<T>::budget();
+        }
+
+        /**
+         * @brief Set memory budget for given type of resources
+         * @return Pointer to self (for method chaining)
+         *
+         * If total size of resources of given type exceeds the budget, least
+         * recently used resources with @ref ResourcePolicy "ResourcePolicy::Cached"
+         * policy which are not referenced from anywhere are unloaded until
+         * the size fits into the budget. Size of each resource is computed
+         * with ResourceTraits. Default is no limit.
+         * @see statistics()
+         */
+        template<class T> inline ResourceManager<Types...>* setBudget(std::size_t bytes) {
+            this->Implementation::ResourceManagerData<T>::setBudget(bytes);
+            return this;
+        }
+
+        /**
+         * @brief Statistics for given type of resources
+         *
+         * @see setBudget()
+         */
+        template<class T> inline ResourceStatistics statistics() const {
+            return this->Implementation::ResourceManagerData<T>::statistics();
+        }
+
         /** @brief Fallback for not found resources */
         template<class T> inline T* fallback() {
             return this->Implementation::ResourceManagerData<T>::fallback();
@@ -47,6 +47,15 @@ template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProg
         /** @brief Texture coordinates */
         typedef Attribute<1, Vector2> TextureCoordinates;
 
+        /**
+         * @brief Vertex color
+         *
+         * Multiplies the final color. Used only if the shader is created
+         * with `Flag::VertexColor`, see @ref VectorFlag and
+         * @ref DistanceFieldVectorFlag.
+         */
+        typedef Attribute<2, Color4<>> Color;
+
         enum: Int {
             VectorTextureLayer = 16 /**< Layer for vector texture */
         };
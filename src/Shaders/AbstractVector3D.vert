@@ -36,14 +36,26 @@ uniform highp mat4 transformationProjectionMatrix;
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = 0) in highp vec4 position;
 layout(location = 1) in mediump vec2 textureCoordinates;
+#ifdef VERTEX_COLOR
+layout(location = 2) in lowp vec4 vertexColor;
+#endif
 #else
 in highp vec4 position;
 in mediump vec2 textureCoordinates;
+#ifdef VERTEX_COLOR
+in lowp vec4 vertexColor;
+#endif
 #endif
 
 out vec2 fragmentTextureCoordinates;
+#ifdef VERTEX_COLOR
+out lowp vec4 interpolatedColor;
+#endif
 
 void main() {
     gl_Position = transformationProjectionMatrix*position;
     fragmentTextureCoordinates = textureCoordinates;
+    #ifdef VERTEX_COLOR
+    interpolatedColor = vertexColor;
+    #endif
 }
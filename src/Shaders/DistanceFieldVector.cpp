@@ -38,7 +38,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldVector(): transformationProjectionMatrixUniform(0), colorUniform(1), outlineColorUniform(2), outlineRangeUniform(3), smoothnessUniform(4) {
+template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldVector(const Flags flags): _flags(flags), transformationProjectionMatrixUniform(0), colorUniform(1), outlineColorUniform(2), outlineRangeUniform(3), smoothnessUniform(4) {
     Corrade::Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -47,13 +47,18 @@ template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldV
     Version v = Context::current()->supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
-    AbstractShaderProgram::attachShader(Shader(v, Shader::Type::Vertex)
-        .addSource(rs.get("compatibility.glsl"))
-        .addSource(rs.get(vertexShaderName<dimensions>())));
+    Shader vertexShader(v, Shader::Type::Vertex);
+    vertexShader.addSource(rs.get("compatibility.glsl"));
+    if(flags & Flag::VertexColor) vertexShader.addSource("#define VERTEX_COLOR\n");
+    vertexShader.addSource(rs.get(vertexShaderName<dimensions>()));
+    AbstractShaderProgram::attachShader(vertexShader);
 
-    AbstractShaderProgram::attachShader(Shader(v, Shader::Type::Fragment)
-        .addSource(rs.get("compatibility.glsl"))
-        .addSource(rs.get("DistanceFieldVector.frag")));
+    Shader fragmentShader(v, Shader::Type::Fragment);
+    fragmentShader.addSource(rs.get("compatibility.glsl"));
+    if(flags & Flag::MultiChannel) fragmentShader.addSource("#define MULTI_CHANNEL\n");
+    if(flags & Flag::VertexColor) fragmentShader.addSource("#define VERTEX_COLOR\n");
+    fragmentShader.addSource(rs.get("DistanceFieldVector.frag"));
+    AbstractShaderProgram::attachShader(fragmentShader);
 
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_attrib_location>() ||
@@ -64,6 +69,8 @@ template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldV
     {
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        if(flags & Flag::VertexColor)
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Color::Location, "vertexColor");
     }
 
     AbstractShaderProgram::link();
@@ -53,13 +53,22 @@ uniform lowp sampler2D vectorTexture;
 #endif
 
 in vec2 fragmentTextureCoordinates;
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedColor;
+#endif
 
 #ifdef NEW_GLSL
 out vec4 fragmentColor;
 #endif
 
 void main() {
+    #ifndef MULTI_CHANNEL
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
+    #else
+    /* Median of the three channels */
+    lowp vec3 channels = texture(vectorTexture, fragmentTextureCoordinates).rgb;
+    lowp float intensity = max(min(channels.r, channels.g), min(max(channels.r, channels.g), channels.b));
+    #endif
 
     /* Fill color */
     fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*color;
@@ -70,4 +79,8 @@ void main() {
         lowp float half = (outlineRange.y - outlineRange.x)/2.0;
         fragmentColor += smoothstep(half+smoothness, half-smoothness, distance(mid, intensity))*outlineColor;
     }
+
+    #ifdef VERTEX_COLOR
+    fragmentColor *= interpolatedColor;
+    #endif
 }
@@ -28,6 +28,8 @@
  * @brief Class Magnum::Shaders::DistanceFieldVector, typedef Magnum::Shaders::DistanceFieldVector2D, Magnum::Shaders::DistanceFieldVector3D
  */
 
+#include <Containers/EnumSet.h>
+
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "AbstractVector.h"
@@ -36,17 +38,64 @@
 
 namespace Magnum { namespace Shaders {
 
+/**
+@brief %DistanceFieldVector shader flag
+
+@see DistanceFieldVectorFlags, DistanceFieldVector::DistanceFieldVector()
+*/
+enum class DistanceFieldVectorFlag: UnsignedByte {
+    /**
+     * Multi-channel distance field, the distance is reconstructed as median
+     * of red, green and blue channel. See
+     * TextureTools::multiChannelDistanceField() for more information.
+     */
+    MultiChannel = 1 << 0,
+
+    /**
+     * Multiply the color with per-vertex color, see
+     * @ref AbstractVector::Color "Color" attribute.
+     */
+    VertexColor = 1 << 1
+};
+
+/**
+@brief %DistanceFieldVector shader flags
+
+@see DistanceFieldVector::DistanceFieldVector()
+*/
+typedef Corrade::Containers::EnumSet<DistanceFieldVectorFlag, UnsignedByte> DistanceFieldVectorFlags;
+
+CORRADE_ENUMSET_OPERATORS(DistanceFieldVectorFlags)
+
 /**
 @brief Distance field vector shader
 
 Renders vector art in form of signed distance field. See TextureTools::distanceField()
 for more information. Note that the final rendered outlook will greatly depend
 on radius of input distance field and value passed to setSmoothness().
+
+Multi-channel distance fields generated with
+TextureTools::multiChannelDistanceField() are rendered when the shader is
+created with @ref DistanceFieldVectorFlag "Flag::MultiChannel". These keep
+sharp corners even when magnified.
 @see DistanceFieldVector2D, DistanceFieldVector3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector: public AbstractVector<dimensions> {
     public:
-        DistanceFieldVector();
+        /** @brief Flag */
+        typedef DistanceFieldVectorFlag Flag;
+
+        /** @brief Flags */
+        typedef DistanceFieldVectorFlags Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DistanceFieldVector(Flags flags = Flags());
+
+        /** @brief Flags */
+        inline Flags flags() const { return _flags; }
 
         /** @brief Set transformation and projection matrix */
         inline DistanceFieldVector* setTransformationProjectionMatrix(const typename DimensionTraits<dimensions>::MatrixType& matrix) {
@@ -109,6 +158,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector
         }
 
     private:
+        Flags _flags;
         Int transformationProjectionMatrixUniform,
             colorUniform,
             outlineColorUniform,
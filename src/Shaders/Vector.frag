@@ -40,6 +40,9 @@ uniform lowp sampler2D vectorTexture;
 #endif
 
 in vec2 fragmentTextureCoordinates;
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedColor;
+#endif
 
 #ifdef NEW_GLSL
 out vec4 fragmentColor;
@@ -48,4 +51,7 @@ out vec4 fragmentColor;
 void main() {
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
     fragmentColor = intensity*color;
+    #ifdef VERTEX_COLOR
+    fragmentColor *= interpolatedColor;
+    #endif
 }
@@ -28,6 +28,8 @@
  * @brief Class Magnum::Shaders::Vector, typedef Magnum::Shaders::Vector2D, Magnum::Shaders::Vector3D
  */
 
+#include <Containers/EnumSet.h>
+
 #include "Math/Matrix3.h"
 #include "Math/Matrix4.h"
 #include "AbstractVector.h"
@@ -36,6 +38,28 @@
 
 namespace Magnum { namespace Shaders {
 
+/**
+@brief %Vector shader flag
+
+@see VectorFlags, Vector::Vector()
+*/
+enum class VectorFlag: UnsignedByte {
+    /**
+     * Multiply the color with per-vertex color, see
+     * @ref AbstractVector::Color "Color" attribute.
+     */
+    VertexColor = 1 << 0
+};
+
+/**
+@brief %Vector shader flags
+
+@see Vector::Vector()
+*/
+typedef Corrade::Containers::EnumSet<VectorFlag, UnsignedByte> VectorFlags;
+
+CORRADE_ENUMSET_OPERATORS(VectorFlags)
+
 /**
 @brief Vector shader
 
@@ -45,7 +69,20 @@ for more advanced effects.
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public AbstractVector<dimensions> {
     public:
-        Vector();
+        /** @brief Flag */
+        typedef VectorFlag Flag;
+
+        /** @brief Flags */
+        typedef VectorFlags Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit Vector(Flags flags = Flags());
+
+        /** @brief Flags */
+        inline Flags flags() const { return _flags; }
 
         /**
          * @brief Set transformation and projection matrix
@@ -66,6 +103,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public Abst
         }
 
     private:
+        Flags _flags;
         Int transformationProjectionMatrixUniform,
             colorUniform;
 };
@@ -0,0 +1,173 @@
+#ifndef Magnum_StridedArrayView_h
+#define Magnum_StridedArrayView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::StridedArrayView
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "Magnum.h"
+
+namespace Magnum {
+
+/**
+@brief Strided array view
+@tparam T           Element type
+
+Non-owning view on array of @p T, where consecutive elements are @ref stride()
+bytes apart. Allows accessing e.g. one attribute of interleaved vertex buffer
+as if it was a plain array, without copying the data. The view is cheap to
+copy and should be passed by value. It is implicitly convertible from
+`std::vector` and from view on non-const type to view on const type. Example
+usage:
+@code
+struct Vertex {
+    Vector3 position;
+    Vector2 textureCoords;
+};
+std::vector<Vertex> vertices;
+
+StridedArrayView<Vector3> positions(&vertices[0].position, vertices.size(), sizeof(Vertex));
+MeshTools::transformPointsInPlace(Matrix4::scaling(Vector3(2.0f)), positions);
+@endcode
+@see Trade::MeshDataView2D, Trade::MeshDataView3D
+*/
+template<class T> class StridedArrayView {
+    template<class> friend class StridedArrayView;
+
+    public:
+        typedef T Type;     /**< @brief Element type */
+
+        /** @brief Random access iterator */
+        class Iterator: public std::iterator<std::random_access_iterator_tag, T> {
+            public:
+                inline constexpr /*implicit*/ Iterator(): _data(nullptr), _stride(0) {}
+
+                /** @brief Constructor */
+                inline constexpr explicit Iterator(typename std::conditional<std::is_const<T>::value, const char, char>::type* data, std::size_t stride): _data(data), _stride(stride) {}
+
+                inline T& operator*() const { return *reinterpret_cast<T*>(_data); }
+                inline T* operator->() const { return reinterpret_cast<T*>(_data); }
+                inline T& operator[](std::ptrdiff_t i) const { return *reinterpret_cast<T*>(_data + i*std::ptrdiff_t(_stride)); }
+
+                inline Iterator& operator++() { _data += _stride; return *this; }
+                inline Iterator operator++(int) { Iterator it(*this); _data += _stride; return it; }
+                inline Iterator& operator--() { _data -= _stride; return *this; }
+                inline Iterator operator--(int) { Iterator it(*this); _data -= _stride; return it; }
+                inline Iterator& operator+=(std::ptrdiff_t i) { _data += i*std::ptrdiff_t(_stride); return *this; }
+                inline Iterator& operator-=(std::ptrdiff_t i) { _data -= i*std::ptrdiff_t(_stride); return *this; }
+                inline Iterator operator+(std::ptrdiff_t i) const { return Iterator(*this) += i; }
+                inline Iterator operator-(std::ptrdiff_t i) const { return Iterator(*this) -= i; }
+                inline std::ptrdiff_t operator-(const Iterator& other) const { return (_data - other._data)/std::ptrdiff_t(_stride); }
+
+                inline bool operator==(const Iterator& other) const { return _data == other._data; }
+                inline bool operator!=(const Iterator& other) const { return _data != other._data; }
+                inline bool operator<(const Iterator& other) const { return _data < other._data; }
+                inline bool operator>(const Iterator& other) const { return _data > other._data; }
+                inline bool operator<=(const Iterator& other) const { return _data <= other._data; }
+                inline bool operator>=(const Iterator& other) const { return _data >= other._data; }
+
+            private:
+                typename std::conditional<std::is_const<T>::value, const char, char>::type* _data;
+                std::size_t _stride;
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates empty view.
+         */
+        inline constexpr /*implicit*/ StridedArrayView(): _data(nullptr), _size(0), _stride(sizeof(T)) {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to first element
+         * @param size      Element count
+         * @param stride    Distance between two consecutive elements in
+         *      bytes. Default is tightly packed array.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Templated so literal zero in initializer list isn't matched as
+           null pointer, which would make e.g. `f({0, 1})` ambiguous for
+           functions overloaded on `std::vector` and view */
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value && std::is_same<typename std::remove_const<U>::type, typename std::remove_const<T>::type>::value>::type> inline explicit StridedArrayView(U* data, std::size_t size, std::size_t stride = sizeof(T)): _data(reinterpret_cast<Char*>(static_cast<T*>(data))), _size(size), _stride(stride) {}
+        #else
+        inline explicit StridedArrayView(T* data, std::size_t size, std::size_t stride = sizeof(T));
+        #endif
+
+        /** @brief Construct view on whole `std::vector` */
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value && std::is_same<typename std::remove_const<U>::type, typename std::remove_const<T>::type>::value>::type> inline /*implicit*/ StridedArrayView(std::vector<U>& data): _data(reinterpret_cast<Char*>(data.data())), _size(data.size()), _stride(sizeof(T)) {}
+
+        /** @overload */
+        template<class U, class = typename std::enable_if<std::is_convertible<const U*, T*>::value && std::is_same<U, typename std::remove_const<T>::type>::value>::type> inline /*implicit*/ StridedArrayView(const std::vector<U>& data): _data(reinterpret_cast<Char*>(data.data())), _size(data.size()), _stride(sizeof(T)) {}
+
+        /** @brief Construct const view from non-const one */
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value && std::is_same<typename std::remove_const<U>::type, typename std::remove_const<T>::type>::value>::type> inline constexpr /*implicit*/ StridedArrayView(const StridedArrayView<U>& other): _data(other._data), _size(other._size), _stride(other._stride) {}
+
+        /** @brief Pointer to first element */
+        inline T* data() const { return reinterpret_cast<T*>(_data); }
+
+        /** @brief Element count */
+        inline constexpr std::size_t size() const { return _size; }
+
+        /** @brief Whether the view is empty */
+        inline constexpr bool empty() const { return !_size; }
+
+        /** @brief Distance between two consecutive elements in bytes */
+        inline constexpr std::size_t stride() const { return _stride; }
+
+        /** @brief Whether the elements are tightly packed */
+        inline constexpr bool isContiguous() const { return _stride == sizeof(T); }
+
+        /** @brief Element access */
+        inline T& operator[](std::size_t i) const { return *reinterpret_cast<T*>(_data + i*_stride); }
+
+        /** @brief Iterator to first element */
+        inline Iterator begin() const { return Iterator(_data, _stride); }
+
+        /** @brief Iterator after last element */
+        inline Iterator end() const { return Iterator(_data + _size*_stride, _stride); }
+
+        /** @brief Copy the elements to tightly packed `std::vector` */
+        inline std::vector<typename std::remove_const<T>::type> toVector() const {
+            return std::vector<typename std::remove_const<T>::type>(begin(), end());
+        }
+
+    private:
+        typedef typename std::conditional<std::is_const<T>::value, const char, char>::type Char;
+
+        Char* _data;
+        std::size_t _size;
+        std::size_t _stride;
+};
+
+}
+
+#endif
@@ -0,0 +1,405 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <thread>
+#include <TestSuite/Tester.h>
+
+#include "AbstractAsyncResourceLoader.h"
+
+namespace Magnum { namespace Test {
+
+class AbstractAsyncResourceLoaderTest: public Corrade::TestSuite::Tester {
+    public:
+        AbstractAsyncResourceLoaderTest();
+
+        void load();
+        void loadFallback();
+        void loadNoThreads();
+        void destroyPending();
+        void completeInvalid();
+        void prefetch();
+        void prefetchLoaded();
+        void priority();
+        void cancel();
+        void cancelCompleted();
+        void stop();
+        void stopNotCalled();
+};
+
+typedef Magnum::ResourceManager<Int> ResourceManager;
+
+class IntResourceLoader: public AbstractAsyncResourceLoader<Int> {
+    public:
+        inline explicit IntResourceLoader(UnsignedInt threadCount = defaultThreadCount()): AbstractAsyncResourceLoader<Int>(threadCount) {}
+
+        inline ~IntResourceLoader() { stop(); }
+
+        using AbstractAsyncResourceLoader<Int>::complete;
+
+    private:
+        void doLoad(ResourceKey key) override {
+            if(key == ResourceKey("hello"))
+                complete(key, new Int(773), ResourceDataState::Final, ResourcePolicy::Resident);
+            else if(key == ResourceKey("mutable"))
+                complete(key, new Int(42), ResourceDataState::Mutable, ResourcePolicy::Manual);
+            else completeNotFound(key);
+        }
+};
+
+/* Records the order of loaded resources. When closed, the workers wait in
+   doLoad() until the loader is opened again, so the test knows what they are
+   doing. */
+class GatedResourceLoader: public AbstractAsyncResourceLoader<Int> {
+    public:
+        inline explicit GatedResourceLoader(UnsignedInt threadCount): AbstractAsyncResourceLoader<Int>(threadCount), _closed(false) {}
+
+        inline ~GatedResourceLoader() {
+            open();
+            stop();
+        }
+
+        using AbstractAsyncResourceLoader<Int>::stop;
+
+        std::vector<ResourceKey> loaded() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _loaded;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _closed = true;
+        }
+
+        void open() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _closed = false;
+            }
+            _changed.notify_all();
+        }
+
+        /* Waits until given count of resources started loading */
+        void waitForStarted(std::size_t count) {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _changed.wait(lock, [this, count]() { return _loaded.size() >= count; });
+        }
+
+    private:
+        void doLoad(ResourceKey key) override {
+            Int order;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _loaded.push_back(key);
+                order = _loaded.size();
+                _changed.notify_all();
+                _changed.wait(lock, [this]() { return !_closed; });
+            }
+
+            complete(key, new Int(order), ResourceDataState::Final, ResourcePolicy::Resident);
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _changed;
+        std::vector<ResourceKey> _loaded;
+        bool _closed;
+};
+
+/* Doesn't call stop() in destructor */
+class BrokenResourceLoader: public AbstractAsyncResourceLoader<Int> {
+    public:
+        inline explicit BrokenResourceLoader(UnsignedInt threadCount): AbstractAsyncResourceLoader<Int>(threadCount) {}
+
+    private:
+        void doLoad(ResourceKey) override {}
+};
+
+AbstractAsyncResourceLoaderTest::AbstractAsyncResourceLoaderTest() {
+    addTests({&AbstractAsyncResourceLoaderTest::load,
+              &AbstractAsyncResourceLoaderTest::loadFallback,
+              &AbstractAsyncResourceLoaderTest::loadNoThreads,
+              &AbstractAsyncResourceLoaderTest::destroyPending,
+              &AbstractAsyncResourceLoaderTest::completeInvalid,
+              &AbstractAsyncResourceLoaderTest::prefetch,
+              &AbstractAsyncResourceLoaderTest::prefetchLoaded,
+              &AbstractAsyncResourceLoaderTest::priority,
+              &AbstractAsyncResourceLoaderTest::cancel,
+              &AbstractAsyncResourceLoaderTest::cancelCompleted,
+              &AbstractAsyncResourceLoaderTest::stop,
+              &AbstractAsyncResourceLoaderTest::stopNotCalled});
+}
+
+void AbstractAsyncResourceLoaderTest::load() {
+    ResourceManager rm;
+    IntResourceLoader* loader = new IntResourceLoader(2);
+    rm.setLoader(loader);
+    CORRADE_COMPARE(loader->threadCount(), 2);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    Resource<Int> mutableData = rm.get<Int>("mutable");
+    Resource<Int> world = rm.get<Int>("world");
+    CORRADE_COMPARE(loader->requestedCount(), 3);
+
+    /* Nothing is passed to the manager until update() is called */
+    loader->wait();
+    CORRADE_COMPARE(loader->pendingCount(), 3);
+    CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+    CORRADE_COMPARE(world.state(), ResourceState::Loading);
+    CORRADE_COMPARE(loader->loadedCount(), 0);
+
+    CORRADE_COMPARE(loader->update(), 3);
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+    CORRADE_COMPARE(loader->loadedCount(), 2);
+    CORRADE_COMPARE(loader->notFoundCount(), 1);
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+    CORRADE_COMPARE(*hello, 773);
+    CORRADE_COMPARE(mutableData.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(*mutableData, 42);
+    CORRADE_COMPARE(world.state(), ResourceState::NotFound);
+
+    /* Already loaded resources are not requested again */
+    rm.get<Int>("hello");
+    CORRADE_COMPARE(loader->requestedCount(), 3);
+    CORRADE_COMPARE(loader->update(), 0);
+}
+
+void AbstractAsyncResourceLoaderTest::loadFallback() {
+    ResourceManager rm;
+    rm.setFallback(new Int(0));
+    IntResourceLoader* loader = new IntResourceLoader;
+    rm.setLoader(loader);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    CORRADE_COMPARE(hello.state(), ResourceState::LoadingFallback);
+    CORRADE_COMPARE(*hello, 0);
+
+    loader->wait();
+    loader->update();
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+    CORRADE_COMPARE(*hello, 773);
+}
+
+void AbstractAsyncResourceLoaderTest::loadNoThreads() {
+    ResourceManager rm;
+    IntResourceLoader* loader = new IntResourceLoader(0);
+    rm.setLoader(loader);
+    CORRADE_COMPARE(loader->threadCount(), 0);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    Resource<Int> world = rm.get<Int>("world");
+    CORRADE_COMPARE(loader->pendingCount(), 2);
+    CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+
+    /* Loaded on this thread in update() */
+    CORRADE_COMPARE(loader->update(), 2);
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+    CORRADE_COMPARE(*hello, 773);
+    CORRADE_COMPARE(world.state(), ResourceState::NotFound);
+}
+
+void AbstractAsyncResourceLoaderTest::destroyPending() {
+    ResourceManager rm;
+    IntResourceLoader* loader = new IntResourceLoader(0);
+    rm.setLoader(loader);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    loader->wait();
+    CORRADE_COMPARE(loader->pendingCount(), 1);
+
+    /* Completed but not passed data get deleted */
+    rm.setLoader<Int>(nullptr);
+    CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+}
+
+void AbstractAsyncResourceLoaderTest::completeInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    IntResourceLoader loader(0);
+    loader.complete("hello", nullptr, ResourceDataState::Final, ResourcePolicy::Resident);
+    CORRADE_COMPARE(out.str(), "AbstractAsyncResourceLoader::complete(): data should be null if and only if state is NotFound\n");
+
+    out.str({});
+    Int data;
+    loader.complete("hello", &data, ResourceDataState::Loading, ResourcePolicy::Resident);
+    CORRADE_COMPARE(out.str(), "AbstractAsyncResourceLoader::complete(): state cannot be Loading\n");
+
+    CORRADE_COMPARE(loader.pendingCount(), 0);
+}
+
+void AbstractAsyncResourceLoaderTest::prefetch() {
+    ResourceManager rm;
+    GatedResourceLoader* loader = new GatedResourceLoader(0);
+    rm.setLoader(loader);
+
+    /* Prefetching doesn't add any reference */
+    loader->prefetch("hello");
+    CORRADE_COMPARE(rm.state<Int>("hello"), ResourceState::Loading);
+    CORRADE_COMPARE(rm.referenceCount<Int>("hello"), 0);
+    CORRADE_COMPARE(loader->requestedCount(), 1);
+
+    /* Requesting it later doesn't queue it again */
+    Resource<Int> hello = rm.get<Int>("hello");
+    CORRADE_COMPARE(loader->requestedCount(), 1);
+    CORRADE_COMPARE(loader->pendingCount(), 1);
+
+    CORRADE_COMPARE(loader->update(), 1);
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+}
+
+void AbstractAsyncResourceLoaderTest::prefetchLoaded() {
+    ResourceManager rm;
+    GatedResourceLoader* loader = new GatedResourceLoader(0);
+    rm.setLoader(loader);
+    rm.set("hello", new Int(3));
+
+    /* Already loaded resource is not requested again */
+    loader->prefetch("hello");
+    CORRADE_COMPARE(loader->requestedCount(), 0);
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+}
+
+void AbstractAsyncResourceLoaderTest::priority() {
+    ResourceManager rm;
+    GatedResourceLoader* loader = new GatedResourceLoader(0);
+    rm.setLoader(loader);
+
+    Resource<Int> first = rm.get<Int>("first");
+    loader->prefetch("far", -100.0f);
+    loader->prefetch("near", -1.0f);
+    loader->prefetch("important", 10.0f);
+    Resource<Int> second = rm.get<Int>("second");
+
+    /* Queued resource can be reprioritized, others not */
+    CORRADE_VERIFY(loader->setPriority("far", -0.5f));
+    CORRADE_VERIFY(!loader->setPriority("unknown", 1.0f));
+
+    CORRADE_COMPARE(loader->update(), 5);
+    CORRADE_COMPARE(loader->loaded(), (std::vector<ResourceKey>{
+        "important", "first", "second", "far", "near"}));
+}
+
+void AbstractAsyncResourceLoaderTest::cancel() {
+    ResourceManager rm;
+    GatedResourceLoader* loader = new GatedResourceLoader(1);
+    rm.setLoader(loader);
+
+    /* The single thread is busy with the first resource, the others wait in
+       the queue */
+    loader->close();
+    Resource<Int> first = rm.get<Int>("first");
+    loader->waitForStarted(1);
+    Resource<Int> second = rm.get<Int>("second");
+    loader->prefetch("third");
+    CORRADE_VERIFY(loader->cancel("second"));
+    CORRADE_VERIFY(loader->cancel("third"));
+    CORRADE_VERIFY(!loader->cancel("unknown"));
+
+    /* Referenced resource is back in not loaded state, unreferenced is
+       removed */
+    CORRADE_COMPARE(second.state(), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.count<Int>(), 2);
+
+    loader->open();
+    loader->wait();
+    CORRADE_COMPARE(loader->update(), 1);
+    CORRADE_COMPARE(first.state(), ResourceState::Final);
+    CORRADE_COMPARE(second.state(), ResourceState::NotLoaded);
+    CORRADE_COMPARE(loader->loaded(), std::vector<ResourceKey>{"first"});
+
+    /* Cancelled resource can be requested again */
+    loader->prefetch("second");
+    loader->wait();
+    loader->update();
+    CORRADE_COMPARE(second.state(), ResourceState::Final);
+}
+
+void AbstractAsyncResourceLoaderTest::cancelCompleted() {
+    ResourceManager rm;
+    GatedResourceLoader* loader = new GatedResourceLoader(1);
+    rm.setLoader(loader);
+
+    Resource<Int> first = rm.get<Int>("first");
+    loader->wait();
+
+    /* Loaded data not yet passed to the manager are discarded */
+    CORRADE_VERIFY(loader->cancel("first"));
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+    CORRADE_COMPARE(loader->update(), 0);
+    CORRADE_COMPARE(first.state(), ResourceState::NotLoaded);
+}
+
+void AbstractAsyncResourceLoaderTest::stop() {
+    ResourceManager rm;
+    GatedResourceLoader* loader = new GatedResourceLoader(1);
+    rm.setLoader(loader);
+
+    /* Running job is finished, queued are discarded */
+    loader->close();
+    Resource<Int> first = rm.get<Int>("first");
+    loader->waitForStarted(1);
+    Resource<Int> second = rm.get<Int>("second");
+    CORRADE_COMPARE(loader->pendingCount(), 2);
+    std::thread waiting([loader]() { loader->wait(); });
+    std::thread stopping([loader]() { loader->stop(); });
+
+    /* Let the first job finish only after the queue is discarded, waiting
+       thread is woken up */
+    while(loader->pendingCount() != 1) std::this_thread::yield();
+    loader->open();
+    stopping.join();
+    waiting.join();
+
+    CORRADE_COMPARE(loader->update(), 1);
+    CORRADE_COMPARE(first.state(), ResourceState::Final);
+    CORRADE_COMPARE(second.state(), ResourceState::Loading);
+
+    /* Nothing is loaded after that */
+    loader->prefetch("third");
+    loader->wait();
+    CORRADE_COMPARE(loader->update(), 0);
+    CORRADE_COMPARE(loader->loaded(), std::vector<ResourceKey>{"first"});
+}
+
+void AbstractAsyncResourceLoaderTest::stopNotCalled() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    {
+        BrokenResourceLoader loader(0);
+    }
+    CORRADE_COMPARE(out.str(), "AbstractAsyncResourceLoader: stop() must be called in subclass destructor\n");
+
+    /* The threads are stopped anyway, so they don't outlive the loader */
+    out.str({});
+    {
+        BrokenResourceLoader loader(2);
+    }
+    CORRADE_COMPARE(out.str(), "AbstractAsyncResourceLoader: stop() must be called in subclass destructor\n");
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::AbstractAsyncResourceLoaderTest)
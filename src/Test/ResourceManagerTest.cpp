@@ -23,6 +23,7 @@
 */
 
 #include <sstream>
+#include <thread>
 #include <TestSuite/Tester.h>
 
 #include "AbstractResourceLoader.h"
@@ -38,12 +39,18 @@ class ResourceManagerTest: public Corrade::TestSuite::Tester {
 
         void state();
         void stateFallback();
+        void changeFallback();
         void stateDisallowed();
         void basic();
+        void changeMutable();
         void residentPolicy();
         void referenceCountedPolicy();
         void manualPolicy();
+        void cachedPolicy();
         void loader();
+        void concurrentReferences();
+        void concurrentLoading();
+        void releaseFromDestructor();
 };
 
 class Data {
@@ -56,6 +63,14 @@ class Data {
 
 typedef Magnum::ResourceManager<Int, Data> ResourceManager;
 
+/* Releases another resource of the same type when destroyed */
+class Node {
+    public:
+        Resource<Node> next;
+};
+
+typedef Magnum::ResourceManager<Node> NodeManager;
+
 class IntResourceLoader: public AbstractResourceLoader<Int> {
     public:
         void load(ResourceKey key) override {
@@ -68,17 +83,33 @@ class IntResourceLoader: public AbstractResourceLoader<Int> {
         }
 };
 
+/* Loads the resources synchronously, odd keys are not found */
+class SyncIntResourceLoader: public AbstractResourceLoader<Int> {
+    public:
+        void load(ResourceKey key) override {
+            AbstractResourceLoader<Int>::load(key);
+            if(key.byteArray()[0] & 1) setNotFound(key);
+            else set(key, new Int(7), ResourceDataState::Final, ResourcePolicy::Resident);
+        }
+};
+
 size_t Data::count = 0;
 
 ResourceManagerTest::ResourceManagerTest() {
     addTests({&ResourceManagerTest::state,
               &ResourceManagerTest::stateFallback,
+              &ResourceManagerTest::changeFallback,
               &ResourceManagerTest::stateDisallowed,
               &ResourceManagerTest::basic,
+              &ResourceManagerTest::changeMutable,
               &ResourceManagerTest::residentPolicy,
               &ResourceManagerTest::referenceCountedPolicy,
               &ResourceManagerTest::manualPolicy,
-              &ResourceManagerTest::loader});
+              &ResourceManagerTest::cachedPolicy,
+              &ResourceManagerTest::loader,
+              &ResourceManagerTest::concurrentReferences,
+              &ResourceManagerTest::concurrentLoading,
+              &ResourceManagerTest::releaseFromDestructor});
 }
 
 void ResourceManagerTest::state() {
@@ -131,6 +162,30 @@ void ResourceManagerTest::stateFallback() {
     CORRADE_COMPARE(Data::count, 0);
 }
 
+void ResourceManagerTest::changeFallback() {
+    ResourceManager rm;
+
+    /* Fallback added after the resource was already checked */
+    Resource<Data> data = rm.get<Data>("data");
+    CORRADE_COMPARE(data.state(), ResourceState::NotLoaded);
+    Data* first = new Data;
+    rm.setFallback<Data>(first);
+    CORRADE_COMPARE(data.state(), ResourceState::NotLoadedFallback);
+    CORRADE_VERIFY(static_cast<Data*>(data) == first);
+
+    /* Replaced fallback, the resource shouldn't point to the deleted one */
+    Data* second = new Data;
+    rm.setFallback<Data>(second);
+    CORRADE_VERIFY(static_cast<Data*>(data) == second);
+    CORRADE_COMPARE(Data::count, 1);
+
+    /* Fallback removed */
+    rm.setFallback<Data>(nullptr);
+    CORRADE_VERIFY(!data);
+    CORRADE_COMPARE(data.state(), ResourceState::NotLoaded);
+    CORRADE_COMPARE(Data::count, 0);
+}
+
 void ResourceManagerTest::stateDisallowed() {
     ResourceManager rm;
 
@@ -177,6 +232,29 @@ void ResourceManagerTest::basic() {
     CORRADE_COMPARE(*theQuestion, 20);
 }
 
+void ResourceManagerTest::changeMutable() {
+    ResourceManager rm;
+    rm.set("first", new Int(1), ResourceDataState::Mutable, ResourcePolicy::Resident);
+    rm.set("second", new Int(2), ResourceDataState::Mutable, ResourcePolicy::Resident);
+
+    Resource<Int> first = rm.get<Int>("first");
+    Resource<Int> second = rm.get<Int>("second");
+    CORRADE_COMPARE(*first, 1);
+    CORRADE_COMPARE(*second, 2);
+
+    /* Changing one resource is visible in all references to it, including
+       copies made before the change */
+    Resource<Int> firstCopy = first;
+    rm.set("first", new Int(10), ResourceDataState::Mutable, ResourcePolicy::Resident);
+    CORRADE_COMPARE(*first, 10);
+    CORRADE_COMPARE(*firstCopy, 10);
+    CORRADE_COMPARE(*second, 2);
+
+    rm.set<Int>("second", nullptr, ResourceDataState::Loading, ResourcePolicy::Resident);
+    CORRADE_COMPARE(second.state(), ResourceState::Loading);
+    CORRADE_COMPARE(*first, 10);
+}
+
 void ResourceManagerTest::residentPolicy() {
     ResourceManager* rm = new ResourceManager;
 
@@ -238,6 +316,59 @@ void ResourceManagerTest::manualPolicy() {
     CORRADE_COMPARE(Data::count, 1);
 }
 
+void ResourceManagerTest::cachedPolicy() {
+    ResourceManager rm;
+    rm.setBudget<Int>(3*sizeof(Int));
+    CORRADE_COMPARE(rm.budget<Int>(), 3*sizeof(Int));
+
+    rm.set("a", new Int(1), ResourceDataState::Final, ResourcePolicy::Cached);
+    rm.set("b", new Int(2), ResourceDataState::Final, ResourcePolicy::Cached);
+    rm.set("c", new Int(3), ResourceDataState::Final, ResourcePolicy::Cached);
+    CORRADE_COMPARE(rm.count<Int>(), 3);
+    CORRADE_COMPARE(rm.statistics<Int>().usedBytes, 3*sizeof(Int));
+
+    /* Least recently used one is evicted */
+    rm.set("d", new Int(4), ResourceDataState::Final, ResourcePolicy::Cached);
+    CORRADE_COMPARE(rm.count<Int>(), 3);
+    CORRADE_COMPARE(rm.state<Int>("a"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.statistics<Int>().evictions, 1);
+    CORRADE_COMPARE(rm.statistics<Int>().evictedBytes, sizeof(Int));
+
+    {
+        /* Referenced resource is not evicted */
+        Resource<Int> b = rm.get<Int>("b");
+        rm.set("e", new Int(5), ResourceDataState::Final, ResourcePolicy::Cached);
+        CORRADE_COMPARE(*b, 2);
+        CORRADE_COMPARE(rm.state<Int>("c"), ResourceState::NotLoaded);
+
+        /* Resident resource counts into the budget, but isn't evicted */
+        rm.set("resident", new Int(6), ResourceDataState::Final, ResourcePolicy::Resident);
+        CORRADE_COMPARE(rm.state<Int>("d"), ResourceState::NotLoaded);
+        CORRADE_COMPARE(rm.state<Int>("e"), ResourceState::Final);
+    }
+
+    /* Released resource is now the most recently used one */
+    rm.set("f", new Int(7), ResourceDataState::Final, ResourcePolicy::Cached);
+    CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Int>("e"), ResourceState::NotLoaded);
+
+    /* Evicted resource is not loaded anymore */
+    Resource<Int> a = rm.get<Int>("a");
+    CORRADE_COMPARE(a.state(), ResourceState::NotLoaded);
+
+    const ResourceStatistics statistics = rm.statistics<Int>();
+    CORRADE_COMPARE(statistics.hits, 1);
+    CORRADE_COMPARE(statistics.misses, 1);
+    CORRADE_COMPARE(statistics.evictions, 4);
+    CORRADE_COMPARE(statistics.evictedBytes, 4*sizeof(Int));
+    CORRADE_COMPARE(statistics.usedBytes, 3*sizeof(Int));
+
+    /* Cached resources can be freed manually */
+    rm.free();
+    CORRADE_COMPARE(rm.count<Int>(), 2);
+    CORRADE_COMPARE(rm.statistics<Int>().usedBytes, sizeof(Int));
+}
+
 void ResourceManagerTest::loader() {
     ResourceManager rm;
     IntResourceLoader loader;
@@ -256,6 +387,89 @@ void ResourceManagerTest::loader() {
     CORRADE_COMPARE(world.state(), ResourceState::NotFound);
 }
 
+void ResourceManagerTest::concurrentReferences() {
+    ResourceManager rm;
+    rm.set("final", new Int(42), ResourceDataState::Final, ResourcePolicy::Resident);
+
+    {
+        Resource<Int> counted = rm.get<Int>("counted");
+        rm.set("counted", new Int(1337), ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+
+        std::vector<std::thread> threads;
+        std::vector<Int> sums(4);
+        for(std::size_t i = 0; i != sums.size(); ++i) threads.emplace_back([&rm, &counted, &sums, i]() {
+            for(std::size_t j = 0; j != 1000; ++j) {
+                Resource<Int> a = rm.get<Int>("final");
+                Resource<Int> b = a;
+                Resource<Int> c = counted;
+                Resource<Int> d = rm.get<Int>(ResourceKey(std::to_string(j)));
+                sums[i] += *b + *c + (d.state() == ResourceState::NotLoaded);
+            }
+        });
+        for(std::thread& thread: threads) thread.join();
+
+        for(Int sum: sums) CORRADE_COMPARE(sum, 1000*(42 + 1337 + 1));
+        CORRADE_COMPARE(rm.referenceCount<Int>("final"), 0);
+        CORRADE_COMPARE(rm.referenceCount<Int>("counted"), 1);
+        CORRADE_COMPARE(rm.count<Int>(), 1002);
+    }
+
+    /* Reference-counted resource is deleted with last reference */
+    CORRADE_COMPARE(rm.count<Int>(), 1001);
+    rm.free();
+    CORRADE_COMPARE(rm.count<Int>(), 1);
+}
+
+void ResourceManagerTest::concurrentLoading() {
+    ResourceManager rm;
+    SyncIntResourceLoader* loader = new SyncIntResourceLoader;
+    rm.setLoader(loader);
+
+    /* All threads request the same keys, each key is loaded only once */
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i != 4; ++i) threads.emplace_back([&rm]() {
+        for(std::size_t j = 0; j != 1000; ++j)
+            rm.get<Int>(ResourceKey(std::to_string(j)));
+    });
+    for(std::thread& thread: threads) thread.join();
+
+    CORRADE_COMPARE(loader->requestedCount(), 1000);
+    CORRADE_COMPARE(loader->loadedCount() + loader->notFoundCount(), 1000);
+    CORRADE_COMPARE(rm.count<Int>(), 1000);
+}
+
+void ResourceManagerTest::releaseFromDestructor() {
+    NodeManager rm;
+
+    /* Chain of reference-counted nodes, each referencing the next one. Many
+       of the neighbors share the same part of the storage, so deleting them
+       while it is locked would deadlock. */
+    {
+        Resource<Node> first = rm.get<Node>("node0");
+        for(std::size_t i = 0; i != 64; ++i) {
+            Node* node = new Node;
+            if(i != 63) node->next = rm.get<Node>(ResourceKey("node" + std::to_string(i + 1)));
+            rm.set(ResourceKey("node" + std::to_string(i)), node, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+        }
+
+        CORRADE_COMPARE(rm.count<Node>(), 64);
+    }
+
+    CORRADE_COMPARE(rm.count<Node>(), 0);
+
+    /* The same for freeing manually managed nodes */
+    for(std::size_t i = 0; i != 64; ++i) {
+        Node* node = new Node;
+        node->next = rm.get<Node>(ResourceKey("counted" + std::to_string(i)));
+        rm.set(ResourceKey("counted" + std::to_string(i)), new Node, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+        rm.set(ResourceKey("manual" + std::to_string(i)), node, ResourceDataState::Final, ResourcePolicy::Manual);
+    }
+
+    CORRADE_COMPARE(rm.count<Node>(), 128);
+    rm.free();
+    CORRADE_COMPARE(rm.count<Node>(), 0);
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::ResourceManagerTest)
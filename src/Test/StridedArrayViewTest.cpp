@@ -0,0 +1,127 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <TestSuite/Tester.h>
+
+#include "StridedArrayView.h"
+
+namespace Magnum { namespace Test {
+
+class StridedArrayViewTest: public Corrade::TestSuite::Tester {
+    public:
+        StridedArrayViewTest();
+
+        void constructEmpty();
+        void constructVector();
+        void constructConst();
+        void access();
+        void iterate();
+        void toVector();
+};
+
+StridedArrayViewTest::StridedArrayViewTest() {
+    addTests({&StridedArrayViewTest::constructEmpty,
+              &StridedArrayViewTest::constructVector,
+              &StridedArrayViewTest::constructConst,
+              &StridedArrayViewTest::access,
+              &StridedArrayViewTest::iterate,
+              &StridedArrayViewTest::toVector});
+}
+
+namespace {
+    struct Vertex {
+        Int position;
+        Float weight;
+    };
+}
+
+void StridedArrayViewTest::constructEmpty() {
+    StridedArrayView<Int> a;
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(a.isContiguous());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.begin() == a.end());
+}
+
+void StridedArrayViewTest::constructVector() {
+    std::vector<Int> data{3, 7, -1};
+    StridedArrayView<Int> a = data;
+    CORRADE_VERIFY(a.data() == data.data());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(Int));
+    CORRADE_VERIFY(a.isContiguous());
+
+    const std::vector<Int>& constData = data;
+    StridedArrayView<const Int> b = constData;
+    CORRADE_VERIFY(b.data() == data.data());
+    CORRADE_COMPARE(b.size(), 3);
+}
+
+void StridedArrayViewTest::constructConst() {
+    std::vector<Int> data{3, 7, -1};
+    StridedArrayView<Int> a = data;
+    StridedArrayView<const Int> b = a;
+    CORRADE_VERIFY(b.data() == data.data());
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), sizeof(Int));
+}
+
+void StridedArrayViewTest::access() {
+    std::vector<Vertex> data{{3, 0.5f}, {7, 1.5f}, {-1, 2.5f}};
+    StridedArrayView<Int> a(&data[0].position, data.size(), sizeof(Vertex));
+    CORRADE_VERIFY(!a.isContiguous());
+    CORRADE_COMPARE(a.stride(), sizeof(Vertex));
+    CORRADE_COMPARE(a[0], 3);
+    CORRADE_COMPARE(a[2], -1);
+
+    a[1] = 42;
+    CORRADE_COMPARE(data[1].position, 42);
+    CORRADE_COMPARE(data[1].weight, 1.5f);
+}
+
+void StridedArrayViewTest::iterate() {
+    std::vector<Vertex> data{{3, 0.5f}, {7, 1.5f}, {-1, 2.5f}};
+    StridedArrayView<Float> a(&data[0].weight, data.size(), sizeof(Vertex));
+    CORRADE_COMPARE(a.end() - a.begin(), 3);
+    CORRADE_COMPARE(a.begin()[2], 2.5f);
+
+    Float sum = 0.0f;
+    for(Float& i: a) {
+        sum += i;
+        i = -i;
+    }
+    CORRADE_COMPARE(sum, 4.5f);
+    CORRADE_COMPARE(data[0].weight, -0.5f);
+    CORRADE_COMPARE(data[2].weight, -2.5f);
+}
+
+void StridedArrayViewTest::toVector() {
+    std::vector<Vertex> data{{3, 0.5f}, {7, 1.5f}, {-1, 2.5f}};
+    StridedArrayView<const Int> a(&data[0].position, data.size(), sizeof(Vertex));
+    CORRADE_COMPARE(a.toVector(), (std::vector<Int>{3, 7, -1}));
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::StridedArrayViewTest)
@@ -24,14 +24,85 @@
 
 #include "Text/AbstractFont.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Image.h"
+#include "Text/GlyphCache.h"
+#include "Text/Implementation/Utf8.h"
+#include "TextureTools/MultiChannelDistanceField.h"
+
 namespace Magnum { namespace Text {
 
 AbstractFont::AbstractFont(): _size(0.0f) {}
 
 AbstractFont::AbstractFont(Corrade::PluginManager::AbstractPluginManager* manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)), _size(0.0f) {}
 
+UnsignedInt AbstractFont::glyphId(char32_t) { return 0; }
+
+Vector2 AbstractFont::glyphAdvance(UnsignedInt) { return {}; }
+
+Vector2 AbstractFont::kerning(UnsignedInt, UnsignedInt) { return {}; }
+
+TextureTools::Outline AbstractFont::glyphOutline(UnsignedInt) { return TextureTools::Outline(); }
+
+bool AbstractFont::createMultiChannelDistanceFieldGlyphCache(GlyphCache* const cache, const std::string& characters, const Float radius) {
+    /* Unique glyph IDs, glyph on zero index first */
+    std::vector<UnsignedInt> glyphs;
+    if(!cache->glyphCount()) glyphs.push_back(0);
+    std::size_t i = 0;
+    for(char32_t character; (character = Implementation::nextUtf8Character(characters, i)) != ~char32_t(0); ) {
+        const UnsignedInt glyph = glyphId(character);
+        if(glyph && std::find(glyphs.begin(), glyphs.end(), glyph) == glyphs.end())
+            glyphs.push_back(glyph);
+    }
+
+    const Int padding = Int(std::ceil(radius));
+    bool hasOutline = false;
+    for(UnsignedInt glyph: glyphs) {
+        const TextureTools::Outline outline = glyphOutline(glyph);
+
+        /* Glyphs without outline (e.g. space) don't need any space in the
+           cache */
+        if(outline.isEmpty()) {
+            cache->insert(glyph, {}, {});
+            continue;
+        }
+
+        hasOutline = true;
+
+        /* Outline is in pixels, whole-pixel area around it with the field
+           radius added */
+        const Rectangle bounds = outline.bounds();
+        const Vector2i position = Vector2i(std::floor(bounds.left()), std::floor(bounds.bottom())) - Vector2i(padding);
+        const Vector2i size = Vector2i(std::ceil(bounds.right()), std::ceil(bounds.top())) + Vector2i(padding) - position;
+        const std::pair<bool, Rectanglei> added = cache->add(glyph, position, size);
+        if(!added.first) return false;
+
+        /* Fourth channel gets true distance, which also keeps the rows
+           aligned */
+        Image2D image(size, Image2D::Format::RGBA, Image2D::Type::UnsignedByte, new UnsignedByte[size.product()*4]);
+        TextureTools::multiChannelDistanceField(outline, {Vector2(position), Vector2(position + size)}, &image, {{}, size}, radius);
+        cache->setImage(added.second.bottomLeft(), &image);
+    }
+
+    return hasOutline;
+}
+
 AbstractLayouter::AbstractLayouter(): _glyphCount(0) {}
 
 AbstractLayouter::~AbstractLayouter() {}
 
+Vector2 AbstractLayouter::layout(Rectangle* const quadPositions, Rectangle* const textureCoordinates) {
+    Vector2 cursorPosition;
+    for(UnsignedInt i = 0; i != _glyphCount; ++i) {
+        Vector2 advance;
+        std::tie(quadPositions[i], textureCoordinates[i], advance) = renderGlyph(cursorPosition, i);
+        cursorPosition += advance;
+    }
+
+    return cursorPosition;
+}
+
 }}
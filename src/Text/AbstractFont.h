@@ -35,6 +35,7 @@
 #include "Magnum.h"
 #include "Texture.h"
 #include "Text/Text.h"
+#include "TextureTools/Outline.h"
 #include "Text/magnumTextVisibility.h"
 
 namespace Magnum { namespace Text {
@@ -51,9 +52,14 @@ information. See TextRenderer for information about text rendering.
 @section AbstractFont-subclassing Subclassing
 
 Plugin implements functions open(), close(), createGlyphCache() and layout().
+Fonts which are able to provide vector glyph outlines should also implement
+glyphId() and glyphOutline(), which are then used for creating
+multi-channel distance field glyph caches with
+createMultiChannelDistanceFieldGlyphCache(). Implementing glyphAdvance() and
+kerning() enables multi-line layout with TextLayouter.
 */
 class MAGNUM_TEXT_EXPORT AbstractFont: public Corrade::PluginManager::AbstractPlugin {
-    PLUGIN_INTERFACE("cz.mosra.magnum.Text.AbstractFont/0.1")
+    PLUGIN_INTERFACE("cz.mosra.magnum.Text.AbstractFont/0.2")
 
     public:
         /** @brief Default constructor */
@@ -98,6 +104,69 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public Corrade::PluginManager::AbstractPl
          */
         virtual void createGlyphCache(GlyphCache* cache, const std::string& characters) = 0;
 
+        /**
+         * @brief Glyph ID for given character
+         *
+         * Default implementation returns `0`, i.e. invalid glyph.
+         * @see glyphOutline()
+         */
+        virtual UnsignedInt glyphId(char32_t character);
+
+        /**
+         * @brief Glyph advance
+         * @param glyph         Glyph ID
+         *
+         * Returns cursor advance after given glyph, scaled to font size().
+         * Default implementation returns zero vector.
+         * @see kerning(), TextLayouter
+         */
+        virtual Vector2 glyphAdvance(UnsignedInt glyph);
+
+        /**
+         * @brief Kerning
+         * @param left          Left glyph ID
+         * @param right         Right glyph ID
+         *
+         * Returns adjustment of cursor position between given pair of
+         * glyphs, scaled to font size(). Default implementation returns zero
+         * vector.
+         * @see glyphAdvance(), TextLayouter
+         */
+        virtual Vector2 kerning(UnsignedInt left, UnsignedInt right);
+
+        /**
+         * @brief Glyph outline
+         * @param glyph         Glyph ID
+         *
+         * Returns outline of given glyph scaled to font size(), relative to
+         * point on baseline. Default implementation returns empty outline.
+         * @see glyphId()
+         */
+        virtual TextureTools::Outline glyphOutline(UnsignedInt glyph);
+
+        /**
+         * @brief Fill glyph cache with multi-channel distance field glyphs
+         * @param cache         Glyph cache instance
+         * @param characters    UTF-8 characters to render
+         * @param radius        Distance field radius in pixels
+         *
+         * Generates glyphs from outlines returned by glyphOutline() using
+         * TextureTools::multiChannelDistanceField() and adds them to the
+         * cache with GlyphCache::add(), thus it can be called repeatedly to
+         * add glyphs on demand. Glyph on zero index is added if not already
+         * present. The cache should have three- or four-component internal
+         * format, e.g. @ref Texture2D::InternalFormat "InternalFormat::RGBA8",
+         * the image is then rendered using Shaders::DistanceFieldVector with
+         * @ref Shaders::DistanceFieldVectorFlag "Flag::MultiChannel". Unlike
+         * with DistanceFieldGlyphCache the glyphs are rendered directly in
+         * the cache resolution, the cache size thus doesn't need to be
+         * scaled.
+         *
+         * Returns `false` if the font doesn't provide glyph outlines or there
+         * isn't enough space in the cache for all glyphs, `true` otherwise.
+         */
+        bool createMultiChannelDistanceFieldGlyphCache(GlyphCache* cache, const std::string& characters, Float radius);
+
         /**
          * @brief Layout the text using font own layouter
          * @param cache     Glyph cache
@@ -146,6 +215,19 @@ class MAGNUM_TEXT_EXPORT AbstractLayouter {
          */
         virtual std::tuple<Rectangle, Rectangle, Vector2> renderGlyph(const Vector2& cursorPosition, UnsignedInt i) = 0;
 
+        /**
+         * @brief Render all glyphs
+         * @param quadPositions         Output array for quad positions
+         * @param textureCoordinates    Output array for texture coordinates
+         *
+         * Fills both arrays, which must have space for at least glyphCount()
+         * items, with all glyphs laid out from origin and returns cursor
+         * position after the last glyph. Default implementation calls
+         * renderGlyph() for each glyph, layouters should reimplement it to
+         * avoid the per-glyph overhead.
+         */
+        virtual Vector2 layout(Rectangle* quadPositions, Rectangle* textureCoordinates);
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #else
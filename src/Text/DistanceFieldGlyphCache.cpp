@@ -24,6 +24,7 @@
 
 #include "DistanceFieldGlyphCache.h"
 
+#include "Context.h"
 #include "Extensions.h"
 #include "Image.h"
 #include "TextureTools/DistanceField.h"
@@ -49,14 +50,30 @@ DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, c
 }
 
 void DistanceFieldGlyphCache::setImage(const Vector2i& offset, Image2D* const image) {
-    Texture2D input;
-    input.setWrapping(Texture2D::Wrapping::ClampToEdge)
-        ->setMinificationFilter(Texture2D::Filter::Linear)
-        ->setMagnificationFilter(Texture2D::Filter::Linear)
-        ->setImage(0, internalFormat, image);
+    #ifndef MAGNUM_TARGET_GLES
+    Context* const context = Context::current();
+    if(context->isVersionSupported(Version::GL330) &&
+       context->isExtensionSupported<Extensions::GL::ARB::explicit_attrib_location>() &&
+       context->isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>() &&
+       context->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>())
+    {
+        Texture2D input;
+        input.setWrapping(Texture2D::Wrapping::ClampToEdge)
+            ->setMinificationFilter(Texture2D::Filter::Linear)
+            ->setMagnificationFilter(Texture2D::Filter::Linear)
+            ->setImage(0, internalFormat, image);
+
+        /* Create distance field from input texture */
+        TextureTools::distanceField(&input, &_texture, Rectanglei::fromSize(offset*scale, image->size()*scale), radius);
+        return;
+    }
+    #endif
 
-    /* Create distance field from input texture */
-    TextureTools::distanceField(&input, &_texture, Rectanglei::fromSize(offset*scale, image->size()*scale), radius);
+    /* Create distance field on CPU and upload it */
+    const Vector2i size = image->size()*scale;
+    Image2D output(size, Image2D::Format::Red, Image2D::Type::UnsignedByte, new UnsignedByte[size.product()]);
+    TextureTools::distanceField(image, &output, Rectanglei::fromSize({}, size), radius);
+    setDistanceFieldImage(offset*scale, &output);
 }
 
 void DistanceFieldGlyphCache::setDistanceFieldImage(const Vector2i& offset, Image2D* const image) {
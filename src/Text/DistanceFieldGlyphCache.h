@@ -71,6 +71,9 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
          *
          * Uploads image for one or more glyphs to given offset in original
          * cache texture. The texture is then converted to distance field.
+         * If the GPU implementation of TextureTools::distanceField() is not
+         * supported by the context, the distance field is computed on CPU
+         * and then uploaded.
          */
         void setImage(const Vector2i& offset, Image2D* image) override;
 
@@ -24,9 +24,10 @@
 
 #include "GlyphCache.h"
 
+#include <Utility/Assert.h>
+
 #include "Extensions.h"
 #include "Image.h"
-#include "TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -38,7 +39,7 @@ namespace {
     #endif
 }
 
-GlyphCache::GlyphCache(const Vector2i& size): _size(size) {
+GlyphCache::GlyphCache(const Vector2i& size): _size(size), _packer(size), _evictionEnabled(false), _useCounter(0), _revision(0), _glyphCount(0) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #else
@@ -48,11 +49,11 @@ GlyphCache::GlyphCache(const Vector2i& size): _size(size) {
     initialize(internalFormat, size);
 }
 
-GlyphCache::GlyphCache(const Vector2i& size, const AbstractTexture::InternalFormat internalFormat): _size(size) {
+GlyphCache::GlyphCache(const Vector2i& size, const AbstractTexture::InternalFormat internalFormat): _size(size), _packer(size), _evictionEnabled(false), _useCounter(0), _revision(0), _glyphCount(0) {
     initialize(internalFormat, size);
 }
 
-GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding) {}
+GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): _size(size), _padding(padding), _packer(size, padding), _evictionEnabled(false), _useCounter(0), _revision(0), _glyphCount(0) {}
 
 GlyphCache::~GlyphCache() = default;
 
@@ -71,17 +72,127 @@ void GlyphCache::initialize(const AbstractTexture::InternalFormat internalFormat
 }
 
 std::vector<Rectanglei> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT(glyphs.empty(), "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
-    glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    std::vector<Rectanglei> rectangles = _packer.add(sizes);
+    if(rectangles.empty() && !sizes.empty()) {
+        Error() << "Text::GlyphCache::reserve(): cache of size" << _size
+                << "is too small to fit" << sizes.size() << "more glyphs";
+        return rectangles;
+    }
+
+    return rectangles;
+}
+
+void GlyphCache::lookup(const UnsignedInt* const ids, const std::size_t count, std::pair<Vector2i, Rectanglei>* const output) const {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Glyph& found = get(ids[i]);
+        found.lastUse = ++_useCounter;
+        output[i] = {found.position, found.rectangle};
+    }
+}
+
+void GlyphCache::touch(const UnsignedInt* const ids, const std::size_t count) const {
+    for(std::size_t i = 0; i != count; ++i)
+        get(ids[i]).lastUse = ++_useCounter;
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, Vector2i position, Rectanglei rectangle) {
+    /* Glyph already present, keep the original one */
+    if(find(glyph)) return;
+
     position -= _padding;
     rectangle.bottomLeft() -= _padding;
     rectangle.topRight() += _padding;
 
-    glyphs.insert({glyph, {position, rectangle}});
+    const Glyph g{position, rectangle, ++_useCounter, true};
+    if(glyph < LowGlyphCount) {
+        if(lowGlyphs.size() <= glyph) lowGlyphs.resize(glyph+1, Glyph{{}, {}, 0, false});
+        lowGlyphs[glyph] = g;
+    } else glyphs.insert({glyph, g});
+
+    ++_glyphCount;
+    ++_revision;
+}
+
+std::pair<bool, Rectanglei> GlyphCache::add(const UnsignedInt glyph, const Vector2i& position, const Vector2i& size) {
+    /* Replacing existing glyph, free its space first so the new one can
+       reuse it. If the new glyph doesn't fit even after that, put the old
+       one back together with its space. */
+    if(Glyph* const existing = find(glyph)) {
+        const Glyph replaced = *existing;
+        const TextureTools::AtlasPacker packer = _packer;
+        remove(glyph);
+
+        const std::pair<bool, Rectanglei> added = add(glyph, position, size);
+        if(!added.first) {
+            _packer = packer;
+            if(glyph < LowGlyphCount) lowGlyphs[glyph] = replaced;
+            else glyphs.insert({glyph, replaced});
+            ++_glyphCount;
+        }
+
+        return added;
+    }
+
+    std::vector<Rectanglei> rectangles = _packer.add({size});
+
+    /* Evict least recently used glyph which leaves enough space after
+       removal. The packer fills freed areas first, so the new glyph will
+       fit there. */
+    if(rectangles.empty() && _evictionEnabled) {
+        const Vector2i paddedSize = size + 2*_padding;
+        const Glyph* evicted = nullptr;
+        UnsignedInt evictedId = 0;
+        auto consider = [&](const UnsignedInt id, const Glyph& g) {
+            const Vector2i glyphSize = g.rectangle.size();
+            if(id == 0 || !g.present || glyphSize.x() < paddedSize.x() || glyphSize.y() < paddedSize.y())
+                return;
+            if(!evicted || g.lastUse < evicted->lastUse) {
+                evicted = &g;
+                evictedId = id;
+            }
+        };
+        for(UnsignedInt i = 0; i != lowGlyphs.size(); ++i)
+            consider(i, lowGlyphs[i]);
+        for(const auto& g: glyphs)
+            consider(g.first, g.second);
+
+        if(evicted) {
+            remove(evictedId);
+            rectangles = _packer.add({size});
+        }
+    }
+
+    if(rectangles.empty()) return {false, {}};
+
+    insert(glyph, position, rectangles.front());
+    return {true, rectangles.front()};
+}
+
+const GlyphCache::Glyph& GlyphCache::fallback() const {
+    static const Glyph empty{{}, {}, 0, false};
+    CORRADE_ASSERT(!lowGlyphs.empty() && lowGlyphs[0].present,
+        "Text::GlyphCache: glyph not found and no glyph on zero index to fall back to", empty);
+    return lowGlyphs[0];
+}
+
+GlyphCache::Glyph* GlyphCache::find(const UnsignedInt glyph) {
+    if(glyph < LowGlyphCount)
+        return glyph < lowGlyphs.size() && lowGlyphs[glyph].present ? &lowGlyphs[glyph] : nullptr;
+
+    auto it = glyphs.find(glyph);
+    return it == glyphs.end() ? nullptr : &it->second;
+}
+
+void GlyphCache::remove(const UnsignedInt glyph) {
+    Glyph* const found = find(glyph);
+    CORRADE_INTERNAL_ASSERT(found);
+    _packer.remove({found->rectangle.bottomLeft()+_padding, found->rectangle.topRight()-_padding});
+
+    if(glyph < LowGlyphCount) found->present = false;
+    else glyphs.erase(glyph);
+
+    --_glyphCount;
+    ++_revision;
 }
 
 void GlyphCache::setImage(const Vector2i& offset, Image2D* const image) {
@@ -29,9 +29,11 @@
  */
 
 #include <unordered_map>
+#include <vector>
 
 #include "Math/Geometry/Rectangle.h"
 #include "Texture.h"
+#include "TextureTools/Atlas.h"
 #include "Text/magnumTextVisibility.h"
 
 namespace Magnum { namespace Text {
@@ -54,6 +56,22 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
 @endcode
 
 See TextRenderer for information about text rendering.
+
+@section GlyphCache-on-demand Adding glyphs on demand
+
+The cache keeps track of free space in the texture, so glyphs can be added
+later without rebuilding it. Use add() to allocate space for the glyph and
+then upload its image with setImage():
+@code
+std::pair<bool, Rectanglei> added = cache->add(glyph, position, image->size());
+if(added.first) cache->setImage(added.second.bottomLeft(), image);
+@endcode
+
+For caches of fixed size it is possible to enable eviction with
+setEvictionEnabled(). If there isn't enough free space when adding a glyph,
+least recently used glyph large enough to make the space is then removed from
+the cache. Text rendered before with the evicted glyph will display the new
+one instead, thus it should be rendered again.
 */
 class MAGNUM_TEXT_EXPORT GlyphCache {
     public:
@@ -84,34 +102,89 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         inline Vector2i textureSize() const { return _size; }
 
         /** @brief Count of glyphs in the cache */
-        inline std::size_t glyphCount() const { return glyphs.size(); }
+        inline std::size_t glyphCount() const { return _glyphCount; }
+
+        /**
+         * @brief Revision
+         *
+         * Incremented on each change of glyph parameters, i.e. when any glyph
+         * is inserted, replaced or evicted. Used by LayoutCache to detect
+         * stale layouts.
+         */
+        inline UnsignedInt revision() const { return _revision; }
+
+        /** @brief Padding around each glyph */
+        inline Vector2i padding() const { return _padding; }
 
         /** @brief Cache texture */
         inline Texture2D* texture() { return &_texture; }
 
+        /** @brief Whether eviction of least recently used glyphs is enabled */
+        inline bool isEvictionEnabled() const { return _evictionEnabled; }
+
+        /**
+         * @brief Enable or disable eviction of least recently used glyphs
+         * @return Pointer to self (for method chaining)
+         *
+         * Disabled by default. See @ref GlyphCache-on-demand "class documentation"
+         * and add() for more information.
+         */
+        inline GlyphCache* setEvictionEnabled(bool enabled) {
+            _evictionEnabled = enabled;
+            return this;
+        }
+
         /**
          * @brief Parameters of given glyph
          * @param glyph         Glyph ID
          *
          * First tuple element is glyph position relative to point on baseline,
          * second element is glyph region in texture atlas. If no glyph is
-         * found, glyph on zero index is returned.
+         * found, glyph on zero index is returned. Marks the glyph as recently
+         * used for purposes of eviction.
+         *
+         * Glyphs with ID lower than 256 are stored in directly indexed table,
+         * thus the lookup doesn't need any hashing.
+         * @see lookup()
          */
         inline std::pair<Vector2i, Rectanglei> operator[](UnsignedInt glyph) const {
-            auto it = glyphs.find(glyph);
-            return it == glyphs.end() ? glyphs.at(0) : it->second;
+            const Glyph& found = get(glyph);
+            found.lastUse = ++_useCounter;
+            return {found.position, found.rectangle};
         }
 
         /**
-         * @brief Layout glyphs with given sizes to the cache
+         * @brief Parameters of more glyphs at once
+         * @param ids           Glyph IDs
+         * @param count         Glyph count
+         * @param output        Output array
+         *
+         * Equivalent to calling operator[]() for each glyph, meant for
+         * fetching parameters of all glyphs in a string in one call. The
+         * output array must have space for at least @p count items.
+         */
+        void lookup(const UnsignedInt* ids, std::size_t count, std::pair<Vector2i, Rectanglei>* output) const;
+
+        /**
+         * @brief Mark glyphs as recently used
+         * @param ids           Glyph IDs
+         * @param count         Glyph count
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to reserve() if no glyph
-         * was stored there, use insert() to store actual glyph on given
-         * position and setImage() to upload glyph image.
+         * Same as lookup(), but without fetching the parameters. Meant for
+         * users which store the glyph parameters elsewhere (such as
+         * LayoutCache), so the glyphs aren't evicted while still in use.
+         */
+        void touch(const UnsignedInt* ids, std::size_t count) const;
+
+        /**
+         * @brief Layout glyphs with given sizes to the cache
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
+         * Returns non-overlapping regions in cache texture to store glyphs,
+         * not overlapping any glyphs already in the cache. Use insert() to
+         * store actual glyph on given position and setImage() to upload
+         * glyph image. If there isn't enough free space for all glyphs, empty
+         * vector is returned.
+         * @see add()
          */
         std::vector<Rectanglei> reserve(const std::vector<Vector2i>& sizes);
 
@@ -126,6 +199,28 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         void insert(UnsignedInt glyph, Vector2i position, Rectanglei rectangle);
 
+        /**
+         * @brief Add glyph to cache
+         * @param glyph         Glyph ID
+         * @param position      Position relative to point on baseline
+         * @param size          Glyph size
+         *
+         * Allocates space for one glyph and inserts it to the cache,
+         * replacing glyph with the same ID, if present. If there is not
+         * enough space and eviction is enabled, least recently used glyph
+         * large enough to make the space is removed. Glyph on zero index is
+         * never evicted.
+         *
+         * First tuple element is `false` if the glyph cannot be added (the
+         * replaced glyph is then kept in the cache), second is region in
+         * cache texture (without padding) to which glyph image should be
+         * uploaded with setImage(). The padding around the region may
+         * contain remains of evicted glyphs, thus it is advised to upload
+         * the image including the padding.
+         * @see reserve(), insert()
+         */
+        std::pair<bool, Rectanglei> add(UnsignedInt glyph, const Vector2i& position, const Vector2i& size);
+
         /**
          * @brief Set cache image
          *
@@ -148,8 +243,39 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         Texture2D _texture;
 
     private:
+        struct Glyph {
+            Vector2i position;
+            Rectanglei rectangle;
+            mutable UnsignedInt lastUse;
+            bool present;
+        };
+
+        /* Glyph with given ID or glyph on zero index, if not found */
+        inline const Glyph& get(UnsignedInt glyph) const {
+            if(glyph < lowGlyphs.size() && lowGlyphs[glyph].present)
+                return lowGlyphs[glyph];
+            if(glyph >= LowGlyphCount) {
+                auto it = glyphs.find(glyph);
+                if(it != glyphs.end()) return it->second;
+            }
+            return fallback();
+        }
+
+        const Glyph& fallback() const;
+        Glyph* find(UnsignedInt glyph);
+        void MAGNUM_LOCAL remove(UnsignedInt glyph);
+
+        /* IDs below this are in lowGlyphs, others in glyphs */
+        static const UnsignedInt LowGlyphCount = 256;
+
         const Vector2i _padding;
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Rectanglei>> glyphs;
+        TextureTools::AtlasPacker _packer;
+        bool _evictionEnabled;
+        mutable UnsignedInt _useCounter;
+        UnsignedInt _revision;
+        std::size_t _glyphCount;
+        std::vector<Glyph> lowGlyphs;
+        std::unordered_map<UnsignedInt, Glyph> glyphs;
 };
 
 }}
@@ -0,0 +1,130 @@
+#ifndef Magnum_Text_Implementation_LineLayout_h
+#define Magnum_Text_Implementation_LineLayout_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <limits>
+#include <utility>
+
+#include "Math/Functions.h"
+#include "Math/Geometry/Rectangle.h"
+#include "Magnum.h"
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* Glyph prepared for line layout, all values are already scaled to final
+   size. Newline characters don't produce any quad, other fields of them are
+   ignored. */
+struct LayoutGlyph {
+    char32_t character;
+    Float kerning;  /* Kerning to previous glyph on the same line */
+    Float advance;
+    Rectangle quad; /* Relative to cursor position on baseline */
+};
+
+/* Align quads [begin, end) of one line and extend bounds with them. The
+   line is shifted left by given fraction of its width, i.e. 0 for left,
+   0.5 for centered and 1 for right alignment. */
+inline void alignLine(Rectangle* const quadPositions, const UnsignedInt begin, const UnsignedInt end, const Float alignment, const Float width, Vector2& min, Vector2& max) {
+    const Float offset = -width*alignment;
+
+    for(UnsignedInt i = begin; i != end; ++i) {
+        Rectangle& quad = quadPositions[i];
+        quad.left() += offset;
+        quad.right() += offset;
+        min = Math::min(min, quad.bottomLeft());
+        max = Math::max(max, quad.topRight());
+    }
+}
+
+/* Break glyphs into lines at newlines and, if wrap width is nonzero, after
+   last space which doesn't exceed the width, then align the lines (see
+   alignLine()). First
+   line baseline is at origin. Returns count of quads written and rectangle
+   spanning them. */
+inline std::pair<UnsignedInt, Rectangle> layoutLines(const LayoutGlyph* const glyphs, const std::size_t count, const Float alignment, const Float wrapWidth, const Float lineAdvance, Rectangle* const quadPositions) {
+    Vector2 min(std::numeric_limits<Float>::max()), max(-std::numeric_limits<Float>::max());
+    UnsignedInt glyphCount = 0;
+    UnsignedInt lineBegin = 0;
+    Float cursor = 0.0f, baseline = 0.0f;
+
+    /* Width of the line without trailing spaces */
+    Float lineWidth = 0.0f;
+
+    /* First glyph after last space in current line and its position, width
+       of the line before the space */
+    UnsignedInt breakGlyph = 0;
+    Float breakCursor = 0.0f, breakLineWidth = 0.0f;
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const LayoutGlyph& glyph = glyphs[i];
+
+        /* Explicit line break */
+        if(glyph.character == U'\n') {
+            alignLine(quadPositions, lineBegin, glyphCount, alignment, lineWidth, min, max);
+            lineBegin = breakGlyph = glyphCount;
+            cursor = lineWidth = 0.0f;
+            baseline -= lineAdvance;
+            continue;
+        }
+
+        cursor += glyph.kerning;
+
+        /* Wrap the line after last space, moving the glyphs after it to new
+           line */
+        if(wrapWidth != 0.0f && glyph.character != U' ' && cursor + glyph.advance > wrapWidth && breakGlyph > lineBegin) {
+            alignLine(quadPositions, lineBegin, breakGlyph, alignment, breakLineWidth, min, max);
+            baseline -= lineAdvance;
+            for(UnsignedInt j = breakGlyph; j != glyphCount; ++j) {
+                Rectangle& quad = quadPositions[j];
+                quad.bottomLeft() -= Vector2(breakCursor, lineAdvance);
+                quad.topRight() -= Vector2(breakCursor, lineAdvance);
+            }
+            cursor -= breakCursor;
+            lineWidth -= breakCursor;
+            lineBegin = breakGlyph;
+        }
+
+        const Vector2 position(cursor, baseline);
+        quadPositions[glyphCount++] = {position + glyph.quad.bottomLeft(), position + glyph.quad.topRight()};
+        cursor += glyph.advance;
+
+        /* Line width is updated only after non-space glyphs, thus it
+           doesn't include any spaces before the break */
+        if(glyph.character == U' ') {
+            breakLineWidth = lineWidth;
+            breakGlyph = glyphCount;
+            breakCursor = cursor;
+        } else lineWidth = cursor;
+    }
+
+    alignLine(quadPositions, lineBegin, glyphCount, alignment, lineWidth, min, max);
+
+    if(!glyphCount) return {0, {}};
+    return {glyphCount, {min, max}};
+}
+
+}}}
+
+#endif
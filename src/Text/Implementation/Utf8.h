@@ -0,0 +1,70 @@
+#ifndef Magnum_Text_Implementation_Utf8_h
+#define Magnum_Text_Implementation_Utf8_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+
+#include "Types.h"
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* Decode UTF-8 character at given position and advance the position past it.
+   Invalid and truncated sequences are skipped, `~char32_t(0)` is returned at
+   the end of the text. */
+inline char32_t nextUtf8Character(const std::string& text, std::size_t& i) {
+    while(i < text.size()) {
+        const UnsignedByte lead = text[i];
+        std::size_t length;
+        char32_t character;
+        if(lead < 0x80) {
+            length = 1;
+            character = lead;
+        } else if((lead & 0xe0) == 0xc0) {
+            length = 2;
+            character = lead & 0x1f;
+        } else if((lead & 0xf0) == 0xe0) {
+            length = 3;
+            character = lead & 0x0f;
+        } else if((lead & 0xf8) == 0xf0) {
+            length = 4;
+            character = lead & 0x07;
+        } else {
+            ++i;
+            continue;
+        }
+
+        std::size_t j = 1;
+        for(; j != length && i + j != text.size() && (UnsignedByte(text[i + j]) & 0xc0) == 0x80; ++j)
+            character = (character << 6)|(UnsignedByte(text[i + j]) & 0x3f);
+        i += j;
+        if(j == length) return character;
+    }
+
+    return ~char32_t(0);
+}
+
+}}}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LayoutCache.h"
+
+#include <functional>
+#include <Utility/Assert.h>
+
+#include "Text/AbstractFont.h"
+#include "Text/GlyphCache.h"
+#include "Text/Implementation/Utf8.h"
+
+namespace Magnum { namespace Text {
+
+LayoutCache::LayoutCache(const std::size_t capacity): _capacity(capacity), _useCounter(0) {
+    CORRADE_ASSERT(capacity, "Text::LayoutCache: capacity must not be zero", );
+}
+
+const LayoutCache::Layout& LayoutCache::layout(AbstractFont* const font, const GlyphCache* const cache, const Float size, const std::string& text) {
+    std::size_t hash = std::hash<std::string>()(text);
+    hash ^= std::hash<const void*>()(font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<const void*>()(cache) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<Float>()(size) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    /* Cached layout, redo it if the glyph cache changed since */
+    auto range = entries.equal_range(hash);
+    for(auto it = range.first; it != range.second; ++it) {
+        Entry& entry = it->second;
+        if(entry.font != font || entry.cache != cache || entry.size != size || entry.text != text)
+            continue;
+
+        /* The layouter marks the glyphs as used when laying the text out
+           again, otherwise it needs to be done here */
+        if(entry.cacheRevision != cache->revision()) fill(entry);
+        else cache->touch(entry.layout.glyphs.data(), entry.layout.glyphs.size());
+        entry.lastUse = ++_useCounter;
+        return entry.layout;
+    }
+
+    /* Cache is full, remove least recently used layout */
+    if(entries.size() >= _capacity) {
+        auto evicted = entries.begin();
+        for(auto it = entries.begin(); it != entries.end(); ++it)
+            if(it->second.lastUse < evicted->second.lastUse) evicted = it;
+        entries.erase(evicted);
+    }
+
+    Entry& entry = entries.insert({hash, {font, cache, size, text, 0, ++_useCounter, {}}})->second;
+    fill(entry);
+    return entry.layout;
+}
+
+void LayoutCache::clear() {
+    entries.clear();
+}
+
+void LayoutCache::fill(Entry& entry) {
+    AbstractLayouter* const layouter = entry.font->layout(entry.cache, entry.size, entry.text);
+
+    /* Vectors keep their capacity when the text is laid out again */
+    Layout& layout = entry.layout;
+    layout.quadPositions.resize(layouter->glyphCount());
+    layout.textureCoordinates.resize(layouter->glyphCount());
+    layouter->layout(layout.quadPositions.data(), layout.textureCoordinates.data());
+    if(layouter->glyphCount()) {
+        Vector2 min = layout.quadPositions.front().bottomLeft(), max = layout.quadPositions.front().topRight();
+        for(const Rectangle& quad: layout.quadPositions) {
+            min = Math::min(min, quad.bottomLeft());
+            max = Math::max(max, quad.topRight());
+        }
+        layout.rectangle = {min, max};
+    } else layout.rectangle = {};
+
+    layout.glyphs.clear();
+    std::size_t i = 0;
+    for(char32_t character; (character = Implementation::nextUtf8Character(entry.text, i)) != ~char32_t(0); )
+        layout.glyphs.push_back(entry.font->glyphId(character));
+
+    entry.cacheRevision = entry.cache->revision();
+    delete layouter;
+}
+
+}}
@@ -0,0 +1,139 @@
+#ifndef Magnum_Text_LayoutCache_h
+#define Magnum_Text_LayoutCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Text::LayoutCache
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Math/Geometry/Rectangle.h"
+#include "Magnum.h"
+#include "Text/Text.h"
+#include "Text/magnumTextVisibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Text layout cache
+
+Stores glyph quads of laid out texts, so texts which are rendered repeatedly
+(e.g. HUD labels re-rendered every frame) don't need to go through
+AbstractFont::layout() each time. Texts are identified by font, glyph cache,
+font size and the text itself, layouts are redone when glyph cache revision
+changes (see GlyphCache::revision()). Lookup of already laid out text doesn't
+allocate any memory.
+@code
+Text::LayoutCache layoutCache;
+
+Text::TextRenderer2D renderer(font, cache, 0.15f);
+renderer.setLayoutCache(&layoutCache);
+@endcode
+
+If the cache is full, least recently used layout is removed. Glyphs of reused
+layouts are marked as recently used in the glyph cache (see
+GlyphCache::touch()), so they aren't evicted while the text is still rendered.
+The glyph IDs are taken from AbstractFont::glyphId() for each character of the
+text.
+
+Layouts are identified by font address and the cache doesn't track state of
+the font. If the font is closed and opened again with different file, or if it
+is destroyed and another font is created at the same address, call clear(),
+otherwise stale layouts would be returned.
+@see AbstractTextRenderer::setLayoutCache()
+*/
+class MAGNUM_TEXT_EXPORT LayoutCache {
+    LayoutCache(const LayoutCache&) = delete;
+    LayoutCache(LayoutCache&&) = delete;
+    LayoutCache& operator=(const LayoutCache&) = delete;
+    LayoutCache& operator=(LayoutCache&&) = delete;
+
+    public:
+        /** @brief Laid out text */
+        struct Layout {
+            /** @brief Quad positions of all glyphs */
+            std::vector<Rectangle> quadPositions;
+
+            /** @brief Texture coordinates of all glyphs */
+            std::vector<Rectangle> textureCoordinates;
+
+            /** @brief Rectangle spanning the text */
+            Rectangle rectangle;
+
+            /** @brief Glyph IDs of all characters in the text */
+            std::vector<UnsignedInt> glyphs;
+        };
+
+        /**
+         * @brief Constructor
+         * @param capacity      Max count of cached layouts
+         */
+        explicit LayoutCache(std::size_t capacity = 256);
+
+        /** @brief Max count of cached layouts */
+        inline std::size_t capacity() const { return _capacity; }
+
+        /** @brief Count of cached layouts */
+        inline std::size_t size() const { return entries.size(); }
+
+        /**
+         * @brief Layout of given text
+         * @param font      Font
+         * @param cache     Glyph cache
+         * @param size      Font size
+         * @param text      %Text to layout
+         *
+         * Returns cached layout or lays out the text using the font and
+         * stores it in the cache. The reference is valid until next call to
+         * this function or clear().
+         */
+        const Layout& layout(AbstractFont* font, const GlyphCache* cache, Float size, const std::string& text);
+
+        /** @brief Remove all cached layouts */
+        void clear();
+
+    private:
+        struct Entry {
+            AbstractFont* font;
+            const GlyphCache* cache;
+            Float size;
+            std::string text;
+            UnsignedInt cacheRevision, lastUse;
+            Layout layout;
+        };
+
+        void MAGNUM_LOCAL fill(Entry& entry);
+
+        std::size_t _capacity;
+        UnsignedInt _useCounter;
+        std::unordered_multimap<std::size_t, Entry> entries;
+};
+
+}}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+#include <TestSuite/Tester.h>
+
+#include "Text/Implementation/LineLayout.h"
+
+namespace Magnum { namespace Text { namespace Implementation { namespace Test {
+
+class LineLayoutTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit LineLayoutTest();
+
+        void empty();
+        void singleLine();
+        void kerning();
+        void newline();
+        void wrap();
+        void wrapNoSpace();
+        void alignRight();
+        void alignCenter();
+};
+
+LineLayoutTest::LineLayoutTest() {
+    addTests({&LineLayoutTest::empty,
+              &LineLayoutTest::singleLine,
+              &LineLayoutTest::kerning,
+              &LineLayoutTest::newline,
+              &LineLayoutTest::wrap,
+              &LineLayoutTest::wrapNoSpace,
+              &LineLayoutTest::alignRight,
+              &LineLayoutTest::alignCenter});
+}
+
+namespace {
+    /* Each glyph is unit square with unit advance */
+    std::vector<LayoutGlyph> glyphs(const std::u32string& text) {
+        std::vector<LayoutGlyph> out;
+        for(char32_t c: text) out.push_back({c, 0.0f, 1.0f, {{}, {1.0f, 1.0f}}});
+        return out;
+    }
+}
+
+void LineLayoutTest::empty() {
+    Rectangle quads[1];
+    std::pair<UnsignedInt, Rectangle> result = layoutLines(nullptr, 0, 0.0f, 0.0f, 1.0f, quads);
+    CORRADE_COMPARE(result.first, 0);
+    CORRADE_COMPARE(result.second, Rectangle());
+}
+
+void LineLayoutTest::singleLine() {
+    const std::vector<LayoutGlyph> g = glyphs(U"ab");
+    Rectangle quads[2];
+    std::pair<UnsignedInt, Rectangle> result = layoutLines(g.data(), g.size(), 0.0f, 0.0f, 1.0f, quads);
+    CORRADE_COMPARE(result.first, 2);
+    CORRADE_COMPARE(quads[0], Rectangle({0.0f, 0.0f}, {1.0f, 1.0f}));
+    CORRADE_COMPARE(quads[1], Rectangle({1.0f, 0.0f}, {2.0f, 1.0f}));
+    CORRADE_COMPARE(result.second, Rectangle({0.0f, 0.0f}, {2.0f, 1.0f}));
+}
+
+void LineLayoutTest::kerning() {
+    std::vector<LayoutGlyph> g = glyphs(U"ab");
+    g[1].kerning = -0.5f;
+    Rectangle quads[2];
+    layoutLines(g.data(), g.size(), 0.0f, 0.0f, 1.0f, quads);
+    CORRADE_COMPARE(quads[1], Rectangle({0.5f, 0.0f}, {1.5f, 1.0f}));
+}
+
+void LineLayoutTest::newline() {
+    const std::vector<LayoutGlyph> g = glyphs(U"ab\nc");
+    Rectangle quads[4];
+    std::pair<UnsignedInt, Rectangle> result = layoutLines(g.data(), g.size(), 0.0f, 0.0f, 2.0f, quads);
+    CORRADE_COMPARE(result.first, 3);
+    CORRADE_COMPARE(quads[2], Rectangle({0.0f, -2.0f}, {1.0f, -1.0f}));
+    CORRADE_COMPARE(result.second, Rectangle({0.0f, -2.0f}, {2.0f, 1.0f}));
+}
+
+void LineLayoutTest::wrap() {
+    /* Second line fits exactly, third wrapped after the space */
+    const std::vector<LayoutGlyph> g = glyphs(U"ab cd ef");
+    Rectangle quads[8];
+    std::pair<UnsignedInt, Rectangle> result = layoutLines(g.data(), g.size(), 0.0f, 5.0f, 2.0f, quads);
+    CORRADE_COMPARE(result.first, 8);
+    CORRADE_COMPARE(quads[4], Rectangle({4.0f, 0.0f}, {5.0f, 1.0f}));
+    CORRADE_COMPARE(quads[6], Rectangle({0.0f, -2.0f}, {1.0f, -1.0f}));
+    CORRADE_COMPARE(quads[7], Rectangle({1.0f, -2.0f}, {2.0f, -1.0f}));
+    CORRADE_COMPARE(result.second, Rectangle({0.0f, -2.0f}, {6.0f, 1.0f}));
+}
+
+void LineLayoutTest::wrapNoSpace() {
+    /* Words longer than wrap width are not broken */
+    const std::vector<LayoutGlyph> g = glyphs(U"abcd");
+    Rectangle quads[4];
+    layoutLines(g.data(), g.size(), 0.0f, 2.0f, 1.0f, quads);
+    CORRADE_COMPARE(quads[3], Rectangle({3.0f, 0.0f}, {4.0f, 1.0f}));
+}
+
+void LineLayoutTest::alignRight() {
+    /* Trailing space is not counted in line width */
+    const std::vector<LayoutGlyph> g = glyphs(U"ab \nc");
+    Rectangle quads[4];
+    std::pair<UnsignedInt, Rectangle> result = layoutLines(g.data(), g.size(), 1.0f, 0.0f, 1.0f, quads);
+    CORRADE_COMPARE(quads[0], Rectangle({-2.0f, 0.0f}, {-1.0f, 1.0f}));
+    CORRADE_COMPARE(quads[2], Rectangle({0.0f, 0.0f}, {1.0f, 1.0f}));
+    CORRADE_COMPARE(quads[3], Rectangle({-1.0f, -1.0f}, {0.0f, 0.0f}));
+    CORRADE_COMPARE(result.second, Rectangle({-2.0f, -1.0f}, {1.0f, 1.0f}));
+}
+
+void LineLayoutTest::alignCenter() {
+    const std::vector<LayoutGlyph> g = glyphs(U"abcd");
+    Rectangle quads[4];
+    std::pair<UnsignedInt, Rectangle> result = layoutLines(g.data(), g.size(), 0.5f, 0.0f, 1.0f, quads);
+    CORRADE_COMPARE(result.second, Rectangle({-2.0f, 0.0f}, {2.0f, 1.0f}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Implementation::Test::LineLayoutTest)
@@ -38,12 +38,20 @@ class AbstractFont;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
 class GlyphCache;
+class LayoutCache;
+class TextLayouter;
+
+enum class Alignment: UnsignedByte;
 
 class AbstractTextRenderer;
 template<UnsignedInt> class TextRenderer;
 typedef TextRenderer<2> TextRenderer2D;
 typedef TextRenderer<3> TextRenderer3D;
 
+template<UnsignedInt> class BatchTextRenderer;
+typedef BatchTextRenderer<2> BatchTextRenderer2D;
+typedef BatchTextRenderer<3> BatchTextRenderer3D;
+
 }}
 
 #endif
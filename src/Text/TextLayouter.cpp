@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextLayouter.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "Text/AbstractFont.h"
+#include "Text/GlyphCache.h"
+#include "Text/Implementation/Utf8.h"
+
+namespace Magnum { namespace Text {
+
+TextLayouter::TextLayouter(AbstractFont* const font, const GlyphCache* const cache, const Float size): _font(font), _cache(cache), _size(size), _wrapWidth(0.0f), _lineAdvance(size), _alignment(Alignment::Left), lowGlyphIds(256, ~UnsignedInt(0)) {}
+
+void TextLayouter::clear() {
+    std::fill(lowGlyphIds.begin(), lowGlyphIds.end(), ~UnsignedInt(0));
+    glyphIds.clear();
+    advances.clear();
+    kernings.clear();
+}
+
+UnsignedInt TextLayouter::glyphId(const char32_t character) {
+    if(character < lowGlyphIds.size()) {
+        UnsignedInt& glyph = lowGlyphIds[character];
+        if(glyph == ~UnsignedInt(0)) glyph = _font->glyphId(character);
+        return glyph;
+    }
+
+    auto found = glyphIds.find(character);
+    if(found != glyphIds.end()) return found->second;
+    return glyphIds.insert({character, _font->glyphId(character)}).first->second;
+}
+
+Float TextLayouter::advance(const UnsignedInt glyph) {
+    if(glyph >= advances.size())
+        advances.resize(std::max(std::size_t(glyph) + 1, advances.size()*2), std::numeric_limits<Float>::quiet_NaN());
+
+    Float& advance = advances[glyph];
+    if(advance != advance) advance = _font->glyphAdvance(glyph).x();
+    return advance;
+}
+
+Float TextLayouter::kerning(const UnsignedInt left, const UnsignedInt right) {
+    const UnsignedLong key = (UnsignedLong(left) << 32)|right;
+    auto found = kernings.find(key);
+    if(found != kernings.end()) return found->second;
+    return kernings.insert({key, _font->kerning(left, right).x()}).first->second;
+}
+
+std::pair<UnsignedInt, Rectangle> TextLayouter::layout(const std::string& text, Rectangle* const quadPositions, Rectangle* const textureCoordinates) {
+    /* Glyph parameters are in font units, cache positions in pixels */
+    const Float scale = _size/_font->size();
+    const Vector2 textureScale = Vector2(1.0f)/Vector2(_cache->textureSize());
+
+    /* Decode the text and fetch cache parameters of all glyphs at once */
+    layoutGlyphs.clear();
+    glyphs.clear();
+    std::size_t i = 0;
+    for(char32_t character; (character = Implementation::nextUtf8Character(text, i)) != ~char32_t(0); ) {
+        layoutGlyphs.push_back({character, 0.0f, 0.0f, {}});
+        if(character != U'\n') glyphs.push_back(glyphId(character));
+    }
+    cached.resize(glyphs.size());
+    _cache->lookup(glyphs.data(), glyphs.size(), cached.data());
+
+    /* Scaled advances, kerning and quads, texture coordinates */
+    UnsignedInt glyphCount = 0, previousGlyph = 0;
+    for(Implementation::LayoutGlyph& layoutGlyph: layoutGlyphs) {
+        if(layoutGlyph.character == U'\n') {
+            previousGlyph = 0;
+            continue;
+        }
+
+        const UnsignedInt glyph = glyphs[glyphCount];
+        const std::pair<Vector2i, Rectanglei>& parameters = cached[glyphCount];
+        if(previousGlyph) layoutGlyph.kerning = kerning(previousGlyph, glyph)*scale;
+        layoutGlyph.advance = advance(glyph)*scale;
+        layoutGlyph.quad = {Vector2(parameters.first)*scale,
+                            Vector2(parameters.first + parameters.second.size())*scale};
+        textureCoordinates[glyphCount] = {Vector2(parameters.second.bottomLeft())*textureScale,
+                                          Vector2(parameters.second.topRight())*textureScale};
+
+        previousGlyph = glyph;
+        ++glyphCount;
+    }
+
+    const Float alignment = _alignment == Alignment::Center ? 0.5f :
+                            _alignment == Alignment::Right ? 1.0f : 0.0f;
+    return Implementation::layoutLines(layoutGlyphs.data(), layoutGlyphs.size(), alignment, _wrapWidth, _lineAdvance, quadPositions);
+}
+
+}}
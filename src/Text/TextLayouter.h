@@ -0,0 +1,195 @@
+#ifndef Magnum_Text_TextLayouter_h
+#define Magnum_Text_TextLayouter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Text::TextLayouter, enum Magnum::Text::Alignment
+ */
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Math/Geometry/Rectangle.h"
+#include "Magnum.h"
+#include "Text/Text.h"
+#include "Text/Implementation/LineLayout.h"
+#include "Text/magnumTextVisibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Horizontal text alignment
+
+@see TextLayouter::setAlignment()
+*/
+enum class Alignment: UnsignedByte {
+    Left,   /**< Lines start at origin */
+    Center, /**< Lines are centered around origin */
+    Right   /**< Lines end at origin */
+};
+
+/**
+@brief Multi-line text layouter
+
+Lays out text into lines in single pass, with optional wrapping at given
+width, alignment and kerning. Unlike AbstractLayouter, which is implemented
+by each font, it uses only glyph parameters provided by the font through
+AbstractFont::glyphId(), AbstractFont::glyphAdvance() and
+AbstractFont::kerning() and glyph positions stored in the cache. These are
+queried only once for each character, glyph and glyph pair and cached in
+tables, so lookups in subsequent layouts are O(1).
+
+@section TextLayouter-usage Usage
+@code
+Text::TextLayouter layouter(font, cache, 0.15f);
+layouter.setWrapWidth(1.0f)
+    ->setAlignment(Text::Alignment::Center);
+
+std::vector<Rectangle> quadPositions(text.size()), textureCoordinates(text.size());
+UnsignedInt glyphCount;
+Rectangle rectangle;
+std::tie(glyphCount, rectangle) = layouter.layout(text, quadPositions.data(), textureCoordinates.data());
+@endcode
+
+Or set it to AbstractTextRenderer or BatchTextRenderer using
+@ref AbstractTextRenderer::setLayouter() "setLayouter()".
+
+First line has baseline at origin, following lines are moved down by
+lineAdvance(). Lines are broken at `\n` characters and, if wrapping is
+enabled, after spaces. Trailing spaces don't count into line width when
+aligning. Words longer than the wrap width are not broken.
+
+The cached tables are not updated when the font changes, call clear() in
+that case.
+*/
+class MAGNUM_TEXT_EXPORT TextLayouter {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         *
+         * Line advance is set to @p size.
+         */
+        explicit TextLayouter(AbstractFont* font, const GlyphCache* cache, Float size);
+
+        /** @brief Font */
+        inline AbstractFont* font() const { return _font; }
+
+        /** @brief Glyph cache */
+        inline const GlyphCache* cache() const { return _cache; }
+
+        /** @brief Font size */
+        inline Float size() const { return _size; }
+
+        /** @brief Alignment */
+        inline Alignment alignment() const { return _alignment; }
+
+        /**
+         * @brief Set alignment
+         * @return Pointer to self (for method chaining)
+         *
+         * Default is @ref Alignment "Alignment::Left".
+         */
+        inline TextLayouter* setAlignment(Alignment alignment) {
+            _alignment = alignment;
+            return this;
+        }
+
+        /** @brief Wrap width */
+        inline Float wrapWidth() const { return _wrapWidth; }
+
+        /**
+         * @brief Set wrap width
+         * @return Pointer to self (for method chaining)
+         *
+         * Lines longer than given width are wrapped after last space. Zero
+         * value disables wrapping, which is the default.
+         */
+        inline TextLayouter* setWrapWidth(Float width) {
+            _wrapWidth = width;
+            return this;
+        }
+
+        /** @brief Line advance */
+        inline Float lineAdvance() const { return _lineAdvance; }
+
+        /**
+         * @brief Set line advance
+         * @return Pointer to self (for method chaining)
+         */
+        inline TextLayouter* setLineAdvance(Float advance) {
+            _lineAdvance = advance;
+            return this;
+        }
+
+        /**
+         * @brief Layout text
+         * @param text                  %Text to layout
+         * @param quadPositions         Output array for quad positions
+         * @param textureCoordinates    Output array for texture coordinates
+         *
+         * Both arrays must have space for at least `text.size()` items.
+         * Returns count of glyphs written to the arrays and rectangle
+         * spanning all glyphs.
+         */
+        std::pair<UnsignedInt, Rectangle> layout(const std::string& text, Rectangle* quadPositions, Rectangle* textureCoordinates);
+
+        /**
+         * @brief Clear cached glyph IDs, advances and kerning
+         *
+         * Call when the font changes.
+         */
+        void clear();
+
+    private:
+        UnsignedInt MAGNUM_LOCAL glyphId(char32_t character);
+        Float MAGNUM_LOCAL advance(UnsignedInt glyph);
+        Float MAGNUM_LOCAL kerning(UnsignedInt left, UnsignedInt right);
+
+        AbstractFont* _font;
+        const GlyphCache* _cache;
+        Float _size, _wrapWidth, _lineAdvance;
+        Alignment _alignment;
+
+        /* Glyph IDs of first 256 characters and advances are directly
+           indexed, unknown values are marked with ~0 and NaN */
+        std::vector<UnsignedInt> lowGlyphIds;
+        std::unordered_map<char32_t, UnsignedInt> glyphIds;
+        std::vector<Float> advances;
+        std::unordered_map<UnsignedLong, Float> kernings;
+
+        /* Reused for decoded text and glyph parameters from the cache */
+        std::vector<Implementation::LayoutGlyph> layoutGlyphs;
+        std::vector<UnsignedInt> glyphs;
+        std::vector<std::pair<Vector2i, Rectanglei>> cached;
+};
+
+}}
+
+#endif
@@ -24,11 +24,15 @@
 
 #include "TextRenderer.h"
 
+#include <algorithm>
+
 #include "Context.h"
 #include "Extensions.h"
 #include "Mesh.h"
 #include "Shaders/AbstractVector.h"
 #include "Text/AbstractFont.h"
+#include "Text/LayoutCache.h"
+#include "Text/TextLayouter.h"
 
 namespace Magnum { namespace Text {
 
@@ -58,110 +62,176 @@ struct Vertex {
     Vector2 position, texcoords;
 };
 
+void createVertices(Vertex* const out, const Rectangle* const quadPositions, const Rectangle* const textureCoordinates, const UnsignedInt glyphCount) {
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
+        const std::size_t vertex = i*4;
+        out[vertex]   = {quadPositions[i].topLeft(), textureCoordinates[i].topLeft()};
+        out[vertex+1] = {quadPositions[i].bottomLeft(), textureCoordinates[i].bottomLeft()};
+        out[vertex+2] = {quadPositions[i].topRight(), textureCoordinates[i].topRight()};
+        out[vertex+3] = {quadPositions[i].bottomRight(), textureCoordinates[i].bottomRight()};
+    }
+}
+
+/* Quad indices for given glyph count, generated once and grown as needed.
+   Not synchronized, use only in functions which upload to GL (which has to
+   be done from the context thread anyway). */
+template<class T> const T* cachedIndices(const UnsignedInt glyphCount) {
+    static std::vector<T> indices;
+    if(indices.size() < glyphCount*6) {
+        const UnsignedInt cachedGlyphCount = std::max(glyphCount, UnsignedInt(indices.size()/6*2));
+        indices.resize(cachedGlyphCount*6);
+        createIndices<T>(indices.data(), cachedGlyphCount);
+    }
+    return indices.data();
+}
+
+/* Smallest index type for given glyph count */
+Mesh::IndexType indexType(const UnsignedInt glyphCount) {
+    const UnsignedInt vertexCount = glyphCount*4;
+    if(vertexCount < 255) return Mesh::IndexType::UnsignedByte;
+    if(vertexCount < 65535) return Mesh::IndexType::UnsignedShort;
+    return Mesh::IndexType::UnsignedInt;
+}
+
+/* Quad index buffers shared by all renderers, one for each index type. Grown
+   on demand, exist as long as there is any renderer. Growing keeps the buffer
+   object, so meshes of other renderers referencing it remain valid. */
+class SharedIndices {
+    public:
+        static void acquire() {
+            if(!instance) instance = new SharedIndices;
+            ++instance->references;
+        }
+
+        static void release() {
+            if(--instance->references) return;
+            delete instance;
+            instance = nullptr;
+        }
+
+        /* Buffer with at least given glyph count of given index type */
+        static Buffer* get(const Mesh::IndexType type, const UnsignedInt glyphCount) {
+            const std::size_t i = type == Mesh::IndexType::UnsignedByte ? 0 :
+                type == Mesh::IndexType::UnsignedShort ? 1 : 2;
+            Buffer& buffer = instance->buffers[i];
+            UnsignedInt& bufferGlyphCount = instance->glyphCounts[i];
+            if(bufferGlyphCount >= glyphCount) return &buffer;
+
+            /* Grow to at least twice the size, up to the limit of index type */
+            constexpr UnsignedInt limits[]{254/4, 65534/4, ~UnsignedInt(0)/4};
+            bufferGlyphCount = std::min(std::max(glyphCount, bufferGlyphCount*2), limits[i]);
+            if(i == 0)
+                buffer.setData(bufferGlyphCount*6*sizeof(UnsignedByte), cachedIndices<UnsignedByte>(bufferGlyphCount), Buffer::Usage::StaticDraw);
+            else if(i == 1)
+                buffer.setData(bufferGlyphCount*6*sizeof(UnsignedShort), cachedIndices<UnsignedShort>(bufferGlyphCount), Buffer::Usage::StaticDraw);
+            else
+                buffer.setData(bufferGlyphCount*6*sizeof(UnsignedInt), cachedIndices<UnsignedInt>(bufferGlyphCount), Buffer::Usage::StaticDraw);
+            return &buffer;
+        }
+
+    private:
+        SharedIndices(): glyphCounts{}, references(0) {
+            for(Buffer& buffer: buffers) buffer.setTargetHint(Buffer::Target::ElementArray);
+        }
+
+        static SharedIndices* instance;
+
+        Buffer buffers[3];
+        UnsignedInt glyphCounts[3];
+        UnsignedInt references;
+};
+
+SharedIndices* SharedIndices::instance = nullptr;
+
+template<UnsignedInt dimensions> struct BatchVertex {
+    typename DimensionTraits<dimensions>::VectorType position;
+    Vector2 texcoords;
+    Color4<> color;
+};
+
+inline Vector2 transformPoint(const Matrix3& transformation, const Vector2& point) {
+    return transformation.transformPoint(point);
+}
+
+inline Vector3 transformPoint(const Matrix4& transformation, const Vector2& point) {
+    return transformation.transformPoint({point, 0.0f});
+}
+
+/* Rectangle spanning the rendered text. Union of all quads, as the first and
+   last glyph don't need to be the extremes for multi-line or aligned text. */
+Rectangle textRectangle(const Rectangle* const quadPositions, const UnsignedInt glyphCount) {
+    if(!glyphCount) return {};
+    Vector2 min = quadPositions[0].bottomLeft(), max = quadPositions[0].topRight();
+    for(UnsignedInt i = 1; i != glyphCount; ++i) {
+        min = Math::min(min, quadPositions[i].bottomLeft());
+        max = Math::max(max, quadPositions[i].topRight());
+    }
+    return {min, max};
+}
+
 }
 
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Rectangle> AbstractTextRenderer::render(AbstractFont* const font, const GlyphCache* const cache, Float size, const std::string& text) {
     AbstractLayouter* const layouter = font->layout(cache, size, text);
-    const UnsignedInt vertexCount = layouter->glyphCount()*4;
+    const UnsignedInt glyphCount = layouter->glyphCount();
+
+    /* Layout all glyphs */
+    std::vector<Rectangle> quadPositions(glyphCount), textureCoordinates(glyphCount);
+    layouter->layout(quadPositions.data(), textureCoordinates.data());
+    delete layouter;
 
     /* Output data */
     std::vector<Vector2> positions, texcoords;
-    positions.reserve(vertexCount);
-    texcoords.reserve(vertexCount);
-
-    /* Render all glyphs */
-    Vector2 cursorPosition;
-    for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
-        /* Position of the texture in the resulting glyph, texture coordinates */
-        Rectangle quadPosition, textureCoordinates;
-        Vector2 advance;
-        std::tie(quadPosition, textureCoordinates, advance) = layouter->renderGlyph(cursorPosition, i);
-
+    positions.reserve(glyphCount*4);
+    texcoords.reserve(glyphCount*4);
+    for(UnsignedInt i = 0; i != glyphCount; ++i) {
         positions.insert(positions.end(), {
-            quadPosition.topLeft(),
-            quadPosition.bottomLeft(),
-            quadPosition.topRight(),
-            quadPosition.bottomRight(),
+            quadPositions[i].topLeft(),
+            quadPositions[i].bottomLeft(),
+            quadPositions[i].topRight(),
+            quadPositions[i].bottomRight(),
         });
         texcoords.insert(texcoords.end(), {
-            textureCoordinates.topLeft(),
-            textureCoordinates.bottomLeft(),
-            textureCoordinates.topRight(),
-            textureCoordinates.bottomRight()
+            textureCoordinates[i].topLeft(),
+            textureCoordinates[i].bottomLeft(),
+            textureCoordinates[i].topRight(),
+            textureCoordinates[i].bottomRight()
         });
-
-        /* Advance cursor position to next character */
-        cursorPosition += advance;
     }
 
-    /* Create indices */
-    std::vector<UnsignedInt> indices(layouter->glyphCount()*6);
-    createIndices<UnsignedInt>(indices.data(), layouter->glyphCount());
+    /* Indices, generated here instead of copying the cached ones, so this
+       function stays reentrant */
+    std::vector<UnsignedInt> indices(glyphCount*6);
+    createIndices<UnsignedInt>(indices.data(), glyphCount);
 
-    /* Rendered rectangle */
-    Rectangle rectangle;
-    if(layouter->glyphCount()) rectangle = {positions[1], positions[positions.size()-2]};
-
-    delete layouter;
-    return std::make_tuple(std::move(positions), std::move(texcoords), std::move(indices), rectangle);
+    return std::make_tuple(std::move(positions), std::move(texcoords), std::move(indices), textRectangle(quadPositions.data(), glyphCount));
 }
 
 std::tuple<Mesh, Rectangle> AbstractTextRenderer::render(AbstractFont* const font, const GlyphCache* const cache, Float size, const std::string& text, Buffer* vertexBuffer, Buffer* indexBuffer, Buffer::Usage usage) {
     AbstractLayouter* const layouter = font->layout(cache, size, text);
+    const UnsignedInt glyphCount = layouter->glyphCount();
 
-    const UnsignedInt vertexCount = layouter->glyphCount()*4;
-    const UnsignedInt indexCount = layouter->glyphCount()*6;
-
-    /* Vertex buffer */
-    std::vector<Vertex> vertices;
-    vertices.reserve(vertexCount);
+    const UnsignedInt vertexCount = glyphCount*4;
+    const UnsignedInt indexCount = glyphCount*6;
 
-    /* Render all glyphs */
-    Vector2 cursorPosition;
-    for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
-        /* Position of the texture in the resulting glyph, texture coordinates */
-        Rectangle quadPosition, textureCoordinates;
-        Vector2 advance;
-        std::tie(quadPosition, textureCoordinates, advance) = layouter->renderGlyph(cursorPosition, i);
-
-        vertices.insert(vertices.end(), {
-            {quadPosition.topLeft(), textureCoordinates.topLeft()},
-            {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-            {quadPosition.topRight(), textureCoordinates.topRight()},
-            {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-        });
+    /* Layout all glyphs */
+    std::vector<Rectangle> quadPositions(glyphCount), textureCoordinates(glyphCount);
+    layouter->layout(quadPositions.data(), textureCoordinates.data());
+    delete layouter;
 
-        /* Advance cursor position to next character */
-        cursorPosition += advance;
-    }
+    /* Vertex buffer */
+    std::vector<Vertex> vertices(vertexCount);
+    createVertices(vertices.data(), quadPositions.data(), textureCoordinates.data(), glyphCount);
     vertexBuffer->setData(vertices, usage);
 
     /* Fill index buffer */
-    Mesh::IndexType indexType;
-    std::size_t indicesSize;
-    char* indices;
-    if(vertexCount < 255) {
-        indexType = Mesh::IndexType::UnsignedByte;
-        indicesSize = indexCount*sizeof(UnsignedByte);
-        indices = new char[indicesSize];
-        createIndices<UnsignedByte>(indices, layouter->glyphCount());
-    } else if(vertexCount < 65535) {
-        indexType = Mesh::IndexType::UnsignedShort;
-        indicesSize = indexCount*sizeof(UnsignedShort);
-        indices = new char[indicesSize];
-        createIndices<UnsignedShort>(indices, layouter->glyphCount());
-    } else {
-        indexType = Mesh::IndexType::UnsignedInt;
-        indicesSize = indexCount*sizeof(UnsignedInt);
-        indices = new char[indicesSize];
-        createIndices<UnsignedInt>(indices, layouter->glyphCount());
-    }
-    indexBuffer->setData(indicesSize, indices, usage);
-    delete indices;
-
-    /* Rendered rectangle */
-    Rectangle rectangle;
-    if(layouter->glyphCount()) rectangle = {vertices[1].position, vertices[vertices.size()-2].position};
+    const Mesh::IndexType indexType = Text::indexType(glyphCount);
+    if(indexType == Mesh::IndexType::UnsignedByte)
+        indexBuffer->setData(indexCount*sizeof(UnsignedByte), cachedIndices<UnsignedByte>(glyphCount), usage);
+    else if(indexType == Mesh::IndexType::UnsignedShort)
+        indexBuffer->setData(indexCount*sizeof(UnsignedShort), cachedIndices<UnsignedShort>(glyphCount), usage);
+    else
+        indexBuffer->setData(indexCount*sizeof(UnsignedInt), cachedIndices<UnsignedInt>(glyphCount), usage);
 
     /* Configure mesh except for vertex buffer (depends on dimension count, done
        in subclass) */
@@ -170,8 +240,7 @@ std::tuple<Mesh, Rectangle> AbstractTextRenderer::render(AbstractFont* const fon
         ->setIndexCount(indexCount)
         ->setIndexBuffer(indexBuffer, 0, indexType, 0, vertexCount);
 
-    delete layouter;
-    return std::make_tuple(std::move(mesh), rectangle);
+    return std::make_tuple(std::move(mesh), textRectangle(quadPositions.data(), glyphCount));
 }
 
 template<UnsignedInt dimensions> std::tuple<Mesh, Rectangle> TextRenderer<dimensions>::render(AbstractFont* const font, const GlyphCache* const cache, Float size, const std::string& text, Buffer* vertexBuffer, Buffer* indexBuffer, Buffer::Usage usage) {
@@ -185,7 +254,7 @@ template<UnsignedInt dimensions> std::tuple<Mesh, Rectangle> TextRenderer<dimens
     return std::move(r);
 }
 
-AbstractTextRenderer::AbstractTextRenderer(AbstractFont* const font, const GlyphCache* const cache, Float size): vertexBuffer(Buffer::Target::Array), indexBuffer(Buffer::Target::ElementArray), font(font), cache(cache), size(size), _capacity(0) {
+AbstractTextRenderer::AbstractTextRenderer(AbstractFont* const font, const GlyphCache* const cache, Float size): vertexBuffer(Buffer::Target::Array), font(font), cache(cache), size(size), _capacity(0), _layoutCache(nullptr), _layouter(nullptr) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
     #else
@@ -194,11 +263,15 @@ AbstractTextRenderer::AbstractTextRenderer(AbstractFont* const font, const Glyph
     #endif
     #endif
 
+    SharedIndices::acquire();
+
     /* Vertex buffer configuration depends on dimension count, done in subclass */
     _mesh.setPrimitive(Mesh::Primitive::Triangles);
 }
 
-AbstractTextRenderer::~AbstractTextRenderer() {}
+AbstractTextRenderer::~AbstractTextRenderer() {
+    SharedIndices::release();
+}
 
 template<UnsignedInt dimensions> TextRenderer<dimensions>::TextRenderer(AbstractFont* const font, const GlyphCache* const cache, const Float size): AbstractTextRenderer(font, cache, size) {
     /* Finalize mesh configuration */
@@ -207,82 +280,224 @@ template<UnsignedInt dimensions> TextRenderer<dimensions>::TextRenderer(Abstract
             typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
 }
 
-void AbstractTextRenderer::reserve(const uint32_t glyphCount, const Buffer::Usage vertexBufferUsage, const Buffer::Usage indexBufferUsage) {
+void AbstractTextRenderer::reserve(const UnsignedInt glyphCount, const Buffer::Usage vertexBufferUsage) {
     _capacity = glyphCount;
 
-    const UnsignedInt vertexCount = glyphCount*4;
-    const UnsignedInt indexCount = glyphCount*6;
-
     /* Allocate vertex buffer, reset vertex count */
-    vertexBuffer.setData(vertexCount*sizeof(Vertex), nullptr, vertexBufferUsage);
+    vertexBuffer.setData(glyphCount*4*sizeof(Vertex), nullptr, vertexBufferUsage);
     _mesh.setVertexCount(0);
 
-    /* Allocate index buffer, reset index count and reconfigure buffer binding */
-    Mesh::IndexType indexType;
-    std::size_t indicesSize;
-    if(vertexCount < 255) {
-        indexType = Mesh::IndexType::UnsignedByte;
-        indicesSize = indexCount*sizeof(UnsignedByte);
-    } else if(vertexCount < 65535) {
-        indexType = Mesh::IndexType::UnsignedShort;
-        indicesSize = indexCount*sizeof(UnsignedShort);
-    } else {
-        indexType = Mesh::IndexType::UnsignedInt;
-        indicesSize = indexCount*sizeof(UnsignedInt);
-    }
-    indexBuffer.setData(indicesSize, nullptr, indexBufferUsage);
+    /* Reset index count and reconfigure buffer binding */
+    const Mesh::IndexType indexType = Text::indexType(glyphCount);
     _mesh.setIndexCount(0)
-        ->setIndexBuffer(&indexBuffer, 0, indexType, 0, vertexCount);
-
-    /* Prefill index buffer */
-    void* indices = indexBuffer.map(0, indicesSize, Buffer::MapFlag::InvalidateBuffer|Buffer::MapFlag::Write);
-    if(vertexCount < 255)
-        createIndices<UnsignedByte>(indices, glyphCount);
-    else if(vertexCount < 65535)
-        createIndices<UnsignedShort>(indices, glyphCount);
-    else
-        createIndices<UnsignedInt>(indices, glyphCount);
-    CORRADE_INTERNAL_ASSERT_OUTPUT(indexBuffer.unmap());
+        ->setIndexBuffer(SharedIndices::get(indexType, glyphCount), 0, indexType, 0, glyphCount*4);
 }
 
 void AbstractTextRenderer::render(const std::string& text) {
-    AbstractLayouter* layouter = font->layout(cache, size, text);
+    /* Take the layout from cache or layout the text into reused arrays */
+    const Rectangle *quadPositions, *textureCoordinates;
+    UnsignedInt glyphCount;
+    if(_layouter) {
+        _quadPositions.resize(text.size());
+        _textureCoordinates.resize(text.size());
+        std::tie(glyphCount, _rectangle) = _layouter->layout(text, _quadPositions.data(), _textureCoordinates.data());
+        quadPositions = _quadPositions.data();
+        textureCoordinates = _textureCoordinates.data();
+    } else if(_layoutCache) {
+        const LayoutCache::Layout& layout = _layoutCache->layout(font, cache, size, text);
+        quadPositions = layout.quadPositions.data();
+        textureCoordinates = layout.textureCoordinates.data();
+        glyphCount = layout.quadPositions.size();
+        _rectangle = layout.rectangle;
+    } else {
+        AbstractLayouter* const layouter = font->layout(cache, size, text);
+        glyphCount = layouter->glyphCount();
+        _quadPositions.resize(glyphCount);
+        _textureCoordinates.resize(glyphCount);
+        layouter->layout(_quadPositions.data(), _textureCoordinates.data());
+        quadPositions = _quadPositions.data();
+        textureCoordinates = _textureCoordinates.data();
+        _rectangle = textRectangle(quadPositions, glyphCount);
+        delete layouter;
+    }
 
-    CORRADE_ASSERT(layouter->glyphCount() <= _capacity, "Text::TextRenderer::render(): capacity" << _capacity << "too small to render" << layouter->glyphCount() << "glyphs", );
+    CORRADE_ASSERT(glyphCount <= _capacity, "Text::TextRenderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
 
     /* Render all glyphs */
-    Vertex* const vertices = static_cast<Vertex*>(vertexBuffer.map(0, layouter->glyphCount()*4*sizeof(Vertex),
-        Buffer::MapFlag::InvalidateBuffer|Buffer::MapFlag::Write));
-    Vector2 cursorPosition;
-    for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
-        /* Position of the texture in the resulting glyph, texture coordinates */
-        Rectangle quadPosition, textureCoordinates;
-        Vector2 advance;
-        std::tie(quadPosition, textureCoordinates, advance) = layouter->renderGlyph(cursorPosition, i);
-
-        if(i == 0)
-            _rectangle.bottomLeft() = quadPosition.bottomLeft();
-        else if(i == layouter->glyphCount()-1)
-            _rectangle.topRight() = quadPosition.topRight();
+    if(glyphCount) {
+        Vertex* const vertices = static_cast<Vertex*>(vertexBuffer.map(0, glyphCount*4*sizeof(Vertex),
+            Buffer::MapFlag::InvalidateBuffer|Buffer::MapFlag::Write));
+        createVertices(vertices, quadPositions, textureCoordinates, glyphCount);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(vertexBuffer.unmap());
+    }
 
-        const std::size_t vertex = i*4;
-        vertices[vertex]   = {quadPosition.topLeft(), textureCoordinates.topLeft()};
-        vertices[vertex+1] = {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()};
-        vertices[vertex+2] = {quadPosition.topRight(), textureCoordinates.topRight()};
-        vertices[vertex+3] = {quadPosition.bottomRight(), textureCoordinates.bottomRight()};
+    /* Update index count */
+    _mesh.setIndexCount(glyphCount*6);
+}
 
-        /* Advance cursor position to next character */
-        cursorPosition += advance;
+template<UnsignedInt dimensions> BatchTextRenderer<dimensions>::BatchTextRenderer(AbstractFont* const font, const GlyphCache* const cache, const Float size): font(font), cache(cache), size(size), _layoutCache(nullptr), _layouter(nullptr), vertexBuffer(Buffer::Target::Array), _capacity(0), _end(0), _dirty(false) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
+    #else
+    #ifdef MAGNUM_TARGET_GLES2
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::map_buffer_range);
+    #endif
+    #endif
+
+    SharedIndices::acquire();
+
+    _mesh.setPrimitive(Mesh::Primitive::Triangles)
+        ->addInterleavedVertexBuffer(&vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates(),
+            typename Shaders::AbstractVector<dimensions>::Color());
+}
+
+template<UnsignedInt dimensions> BatchTextRenderer<dimensions>::~BatchTextRenderer() {
+    SharedIndices::release();
+}
+
+template<UnsignedInt dimensions> void BatchTextRenderer<dimensions>::reserve(const UnsignedInt glyphCount, const Buffer::Usage vertexBufferUsage) {
+    _capacity = glyphCount;
+
+    vertexBuffer.setData(glyphCount*4*sizeof(BatchVertex<dimensions>), nullptr, vertexBufferUsage);
+    const Mesh::IndexType indexType = Text::indexType(glyphCount);
+    _mesh.setIndexCount(0)
+        ->setIndexBuffer(SharedIndices::get(indexType, glyphCount), 0, indexType, 0, glyphCount*4);
+
+    /* Buffer contents are lost, including degenerate glyphs in holes, so
+       pack the texts together and upload everything again */
+    compact();
+}
+
+template<UnsignedInt dimensions> UnsignedInt BatchTextRenderer<dimensions>::add(const std::string& text, const typename DimensionTraits<dimensions>::MatrixType& transformation, const Color4<>& color, const UnsignedInt glyphCapacity) {
+    texts.push_back({text, transformation, color, {}, {}, {}, 0, 0, true});
+    Entry& entry = texts.back();
+    layout(entry);
+    place(entry, glyphCapacity);
+    return texts.size()-1;
+}
+
+template<UnsignedInt dimensions> BatchTextRenderer<dimensions>* BatchTextRenderer<dimensions>::setText(const UnsignedInt id, const std::string& text) {
+    Entry& entry = texts[id];
+    entry.text = text;
+    layout(entry);
+    place(entry, 0);
+    return this;
+}
+
+template<UnsignedInt dimensions> BatchTextRenderer<dimensions>* BatchTextRenderer<dimensions>::setTransformation(const UnsignedInt id, const typename DimensionTraits<dimensions>::MatrixType& transformation) {
+    texts[id].transformation = transformation;
+    texts[id].dirty = _dirty = true;
+    return this;
+}
+
+template<UnsignedInt dimensions> BatchTextRenderer<dimensions>* BatchTextRenderer<dimensions>::setColor(const UnsignedInt id, const Color4<>& color) {
+    texts[id].color = color;
+    texts[id].dirty = _dirty = true;
+    return this;
+}
+
+template<UnsignedInt dimensions> void BatchTextRenderer<dimensions>::layout(Entry& entry) {
+    /* Vectors keep their capacity, so relayouting doesn't allocate */
+    if(_layouter) {
+        entry.quadPositions.resize(entry.text.size());
+        entry.textureCoordinates.resize(entry.text.size());
+        UnsignedInt glyphCount;
+        std::tie(glyphCount, entry.rectangle) = _layouter->layout(entry.text, entry.quadPositions.data(), entry.textureCoordinates.data());
+        entry.quadPositions.resize(glyphCount);
+        entry.textureCoordinates.resize(glyphCount);
+    } else if(_layoutCache) {
+        const LayoutCache::Layout& layout = _layoutCache->layout(font, cache, size, entry.text);
+        entry.quadPositions = layout.quadPositions;
+        entry.textureCoordinates = layout.textureCoordinates;
+        entry.rectangle = layout.rectangle;
+    } else {
+        AbstractLayouter* const layouter = font->layout(cache, size, entry.text);
+        entry.quadPositions.resize(layouter->glyphCount());
+        entry.textureCoordinates.resize(layouter->glyphCount());
+        layouter->layout(entry.quadPositions.data(), entry.textureCoordinates.data());
+        entry.rectangle = textRectangle(entry.quadPositions.data(), layouter->glyphCount());
+        delete layouter;
     }
-    CORRADE_INTERNAL_ASSERT_OUTPUT(vertexBuffer.unmap());
+}
 
-    /* Update index count */
-    _mesh.setIndexCount(layouter->glyphCount()*6);
+template<UnsignedInt dimensions> void BatchTextRenderer<dimensions>::place(Entry& entry, const UnsignedInt glyphCapacity) {
+    entry.dirty = _dirty = true;
 
-    delete layouter;
+    /* Still fits into its range */
+    const UnsignedInt glyphCount = std::max(UnsignedInt(entry.quadPositions.size()), glyphCapacity);
+    if(glyphCount <= entry.glyphCapacity) return;
+
+    /* Move the text to the end, leaving a hole in place of the old range */
+    if(entry.glyphCapacity) holes.push_back({entry.offset, entry.glyphCapacity});
+    entry.glyphCapacity = glyphCount;
+    if(_end + glyphCount <= _capacity) {
+        entry.offset = _end;
+        _end += glyphCount;
+    } else compact();
+}
+
+template<UnsignedInt dimensions> void BatchTextRenderer<dimensions>::compact() {
+    holes.clear();
+    _end = 0;
+    for(Entry& entry: texts) {
+        entry.offset = _end;
+        entry.dirty = true;
+        _end += entry.glyphCapacity;
+    }
+    _dirty = true;
+
+    CORRADE_ASSERT(_end <= _capacity, "Text::BatchTextRenderer: capacity" << _capacity << "too small to render" << _end << "glyphs", );
+}
+
+template<UnsignedInt dimensions> void BatchTextRenderer<dimensions>::update() {
+    if(!_dirty) return;
+    _dirty = false;
+
+    _mesh.setIndexCount(_end*6);
+    if(!_end) return;
+
+    /* Map used part of the buffer, flush only changed ranges */
+    typedef BatchVertex<dimensions> Vertex;
+    Vertex* const vertices = static_cast<Vertex*>(vertexBuffer.map(0, _end*4*sizeof(Vertex),
+        Buffer::MapFlag::Write|Buffer::MapFlag::FlushExplicit));
+
+    /* Degenerate glyphs in place of moved texts */
+    for(const std::pair<UnsignedInt, UnsignedInt>& hole: holes) {
+        std::fill_n(vertices + hole.first*4, hole.second*4, Vertex());
+        vertexBuffer.flushMappedRange(hole.first*4*sizeof(Vertex), hole.second*4*sizeof(Vertex));
+    }
+    holes.clear();
+
+    for(Entry& entry: texts) {
+        if(!entry.dirty) continue;
+        entry.dirty = false;
+        if(!entry.glyphCapacity) continue;
+
+        Vertex* const out = vertices + entry.offset*4;
+        const UnsignedInt glyphCount = entry.quadPositions.size();
+        for(UnsignedInt i = 0; i != glyphCount; ++i) {
+            const Rectangle& quadPosition = entry.quadPositions[i];
+            const Rectangle& textureCoordinates = entry.textureCoordinates[i];
+            const std::size_t vertex = i*4;
+            out[vertex]   = {transformPoint(entry.transformation, quadPosition.topLeft()), textureCoordinates.topLeft(), entry.color};
+            out[vertex+1] = {transformPoint(entry.transformation, quadPosition.bottomLeft()), textureCoordinates.bottomLeft(), entry.color};
+            out[vertex+2] = {transformPoint(entry.transformation, quadPosition.topRight()), textureCoordinates.topRight(), entry.color};
+            out[vertex+3] = {transformPoint(entry.transformation, quadPosition.bottomRight()), textureCoordinates.bottomRight(), entry.color};
+        }
+
+        /* Rest of the range is filled with degenerate glyphs */
+        std::fill(out + glyphCount*4, out + entry.glyphCapacity*4, Vertex());
+        vertexBuffer.flushMappedRange(entry.offset*4*sizeof(Vertex), entry.glyphCapacity*4*sizeof(Vertex));
+    }
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(vertexBuffer.unmap());
 }
 
 template class TextRenderer<2>;
 template class TextRenderer<3>;
+template class BatchTextRenderer<2>;
+template class BatchTextRenderer<3>;
 
 }}
@@ -25,11 +25,14 @@
 */
 
 /** @file
- * @brief Class Magnum::Text::AbstractTextRenderer, Magnum::Text::TextRenderer, typedef Magnum::Text::TextRenderer2D, Magnum::Text::TextRenderer3D
+ * @brief Class Magnum::Text::AbstractTextRenderer, Magnum::Text::TextRenderer, Magnum::Text::BatchTextRenderer, typedef Magnum::Text::TextRenderer2D, Magnum::Text::TextRenderer3D, Magnum::Text::BatchTextRenderer2D, Magnum::Text::BatchTextRenderer3D
  */
 
 #include "Math/Geometry/Rectangle.h"
+#include "Math/Matrix3.h"
+#include "Math/Matrix4.h"
 #include "Buffer.h"
+#include "Color.h"
 #include "DimensionTraits.h"
 #include "Mesh.h"
 #include "Text/Text.h"
@@ -85,26 +88,74 @@ class MAGNUM_TEXT_EXPORT AbstractTextRenderer {
         /** @brief Text mesh */
         inline Mesh* mesh() { return &_mesh; }
 
+        /** @brief Layout cache */
+        inline LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         * @return Pointer to self (for method chaining)
+         *
+         * If set, render() takes the glyph quads from given cache instead of
+         * laying the text out each time. The cache can be shared among more
+         * renderers. Initially no cache is set.
+         */
+        inline AbstractTextRenderer* setLayoutCache(LayoutCache* cache) {
+            _layoutCache = cache;
+            return this;
+        }
+
+        /** @brief %Text layouter */
+        inline TextLayouter* layouter() const { return _layouter; }
+
+        /**
+         * @brief Set text layouter
+         * @return Pointer to self (for method chaining)
+         *
+         * If set, render() lays the text out using given layouter, which
+         * handles kerning, line breaking and alignment, instead of the font
+         * layouter. It takes precedence over layout cache. Note that the
+         * layouter should use the same font, glyph cache and size as the
+         * renderer. Initially no layouter is set.
+         */
+        inline AbstractTextRenderer* setLayouter(TextLayouter* layouter) {
+            _layouter = layouter;
+            return this;
+        }
+
         /**
          * @brief Reserve capacity for rendered glyphs
          *
-         * Reallocates memory in buffers to hold @p glyphCount glyphs and
-         * prefills index buffer. Consider using appropriate @p vertexBufferUsage
-         * if the text will be changed frequently. Index buffer is changed
-         * only by calling this function, thus @p indexBufferUsage generally
-         * doesn't need to be so dynamic if the capacity won't be changed much.
+         * Reallocates memory in vertex buffer to hold @p glyphCount glyphs.
+         * Consider using appropriate @p vertexBufferUsage if the text will be
+         * changed frequently. The index buffer is shared among all renderers
+         * and grown if it is too small for @p glyphCount glyphs, so no
+         * indices are generated or uploaded if the capacity is already
+         * large enough.
          *
          * Initially zero capacity is reserved.
          * @see capacity()
          */
-        void reserve(UnsignedInt glyphCount, Buffer::Usage vertexBufferUsage, Buffer::Usage indexBufferUsage);
+        void reserve(UnsignedInt glyphCount, Buffer::Usage vertexBufferUsage);
+
+        /**
+         * @copybrief reserve(UnsignedInt, Buffer::Usage)
+         *
+         * @deprecated The index buffer is shared among all renderers, use
+         *      reserve(UnsignedInt, Buffer::Usage) instead. @p indexBufferUsage
+         *      is ignored.
+         */
+        inline void reserve(UnsignedInt glyphCount, Buffer::Usage vertexBufferUsage, Buffer::Usage) {
+            reserve(glyphCount, vertexBufferUsage);
+        }
 
         /**
          * @brief Render text
          *
          * Renders the text to vertex buffer, reusing index buffer already
          * filled with reserve(). Rectangle spanning the rendered text is
-         * available through rectangle().
+         * available through rectangle(). If layouter or layout cache is set,
+         * the text layout is taken from it, see setLayouter() and
+         * setLayoutCache().
          *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
@@ -120,7 +171,7 @@ class MAGNUM_TEXT_EXPORT AbstractTextRenderer {
         static std::tuple<Mesh, Rectangle> MAGNUM_LOCAL render(AbstractFont* font, const GlyphCache* cache, Float size, const std::string& text, Buffer* vertexBuffer, Buffer* indexBuffer, Buffer::Usage usage);
 
         Mesh _mesh;
-        Buffer vertexBuffer, indexBuffer;
+        Buffer vertexBuffer;
 
     private:
         AbstractFont* const font;
@@ -128,6 +179,11 @@ class MAGNUM_TEXT_EXPORT AbstractTextRenderer {
         Float size;
         UnsignedInt _capacity;
         Rectangle _rectangle;
+        LayoutCache* _layoutCache;
+        TextLayouter* _layouter;
+
+        /* Reused for layouts not going through layout cache */
+        std::vector<Rectangle> _quadPositions, _textureCoordinates;
 };
 
 /**
@@ -176,7 +232,7 @@ Shaders::VectorShader2D* shader;
 
 // Initialize renderer and reserve memory for enough glyphs
 Text::TextRenderer2D renderer(font, cache, 0.15f);
-renderer.reserve(32, Buffer::Usage::DynamicDraw, Buffer::Usage::StaticDraw);
+renderer.reserve(32, Buffer::Usage::DynamicDraw);
 
 // Update the text occasionally
 renderer.render("Hello World Countdown: 10");
@@ -231,6 +287,244 @@ typedef TextRenderer<2> TextRenderer2D;
 /** @brief Three-dimensional text renderer */
 typedef TextRenderer<3> TextRenderer3D;
 
+/**
+@brief Batch text renderer
+
+Renders many texts, each with its own transformation and color, into one
+vertex buffer, so all of them can be drawn with single draw call. Compared to
+having one TextRenderer for each text it saves buffer allocations, buffer
+mapping and draw calls.
+
+@section BatchTextRenderer-usage Usage
+
+Reserve capacity for all glyphs, add the texts and then update the buffer
+each frame before drawing. The mesh is prepared for use with
+Shaders::AbstractVector subclasses created with `Flag::VertexColor`, e.g.
+@ref Shaders::VectorFlag "Shaders::Vector2D::Flag::VertexColor":
+@code
+Text::AbstractFont* font;
+Text::GlyphCache* cache;
+Shaders::Vector2D shader(Shaders::Vector2D::Flag::VertexColor);
+
+Text::BatchTextRenderer2D renderer(font, cache, 0.15f);
+renderer.reserve(4096, Buffer::Usage::DynamicDraw);
+UnsignedInt fps = renderer.add("FPS: 60", Matrix3::translation({-0.9f, 0.9f}), Color3<>(1.0f));
+UnsignedInt score = renderer.add("Score: 0", Matrix3::translation({0.5f, 0.9f}), Color3<>(1.0f, 1.0f, 0.0f));
+
+// Each frame
+renderer.setText(fps, "FPS: 59")
+    ->update();
+shader.setTransformationProjectionMatrix(projection)
+    ->setColor(Color3<>(1.0f))
+    ->use();
+cache->texture()->bind(Shaders::Vector2D::VectorTextureLayer);
+renderer.mesh()->draw();
+@endcode
+
+@section BatchTextRenderer-updates Updates
+
+Each text occupies continuous range of the vertex buffer. Changes done with
+setText(), setTransformation() and setColor() are only recorded and update()
+then maps the buffer once with @ref Buffer::MapFlag "MapFlag::FlushExplicit"
+and flushes only ranges of changed texts. A text which doesn't fit into its
+range anymore is moved to the end of used part of the buffer, leaving
+degenerate glyphs in place of the original range. If there isn't enough space
+at the end, all texts are compacted. Space reserved for the text with add()
+is kept if the text gets shorter, thus it is advised to add the texts with
+their expected maximal length to avoid moves.
+
+If layout cache is set (see setLayoutCache()), the texts are laid out using
+it.
+
+@section BatchTextRenderer-extensions Required OpenGL functionality
+
+Requires @extension{ARB,map_buffer_range} (also part of OpenGL ES 3.0 or
+available as @es_extension{EXT,map_buffer_range} in ES 2.0).
+
+@see BatchTextRenderer2D, BatchTextRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchTextRenderer {
+    BatchTextRenderer(const BatchTextRenderer<dimensions>&) = delete;
+    BatchTextRenderer(BatchTextRenderer<dimensions>&&) = delete;
+    BatchTextRenderer<dimensions>& operator=(const BatchTextRenderer<dimensions>&) = delete;
+    BatchTextRenderer<dimensions>& operator=(BatchTextRenderer<dimensions>&&) = delete;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         */
+        explicit BatchTextRenderer(AbstractFont* font, const GlyphCache* cache, Float size);
+
+        ~BatchTextRenderer();
+
+        /**
+         * @brief Capacity for rendered glyphs of all texts
+         *
+         * @see reserve()
+         */
+        inline UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Count of texts */
+        inline UnsignedInt textCount() const { return texts.size(); }
+
+        /** @brief Text mesh */
+        inline Mesh* mesh() { return &_mesh; }
+
+        /** @brief Layout cache */
+        inline LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         * @return Pointer to self (for method chaining)
+         *
+         * See AbstractTextRenderer::setLayoutCache() for more information.
+         */
+        inline BatchTextRenderer<dimensions>* setLayoutCache(LayoutCache* cache) {
+            _layoutCache = cache;
+            return this;
+        }
+
+        /** @brief %Text layouter */
+        inline TextLayouter* layouter() const { return _layouter; }
+
+        /**
+         * @brief Set text layouter
+         * @return Pointer to self (for method chaining)
+         *
+         * See AbstractTextRenderer::setLayouter() for more information.
+         */
+        inline BatchTextRenderer<dimensions>* setLayouter(TextLayouter* layouter) {
+            _layouter = layouter;
+            return this;
+        }
+
+        /**
+         * @brief Reserve capacity for rendered glyphs
+         *
+         * Reallocates vertex buffer to hold @p glyphCount glyphs of all
+         * texts. The texts are packed together without any unused space
+         * between them and uploaded again on next update(). See
+         * AbstractTextRenderer::reserve() for more information. Initially
+         * zero capacity is reserved.
+         * @see capacity()
+         */
+        void reserve(UnsignedInt glyphCount, Buffer::Usage vertexBufferUsage);
+
+        /**
+         * @brief Add text
+         * @param text              %Text to render
+         * @param transformation    %Text transformation
+         * @param color             %Text color
+         * @param glyphCapacity     Space to reserve for the text
+         *
+         * Returns ID of the text, which can be used for subsequent changes.
+         * If @p glyphCapacity is larger than glyph count of @p text, the
+         * space is kept for later longer texts.
+         * @attention The capacity must be large enough to contain all glyphs,
+         *      see reserve() for more information.
+         */
+        UnsignedInt add(const std::string& text, const typename DimensionTraits<dimensions>::MatrixType& transformation = typename DimensionTraits<dimensions>::MatrixType(), const Color4<>& color = Color4<>(1.0f), UnsignedInt glyphCapacity = 0);
+
+        /** @brief %Text with given ID */
+        inline const std::string& text(UnsignedInt id) const {
+            return texts[id].text;
+        }
+
+        /**
+         * @brief Set text
+         * @return Pointer to self (for method chaining)
+         *
+         * The text is laid out immediately, the buffer is updated on next
+         * update().
+         * @attention The capacity must be large enough to contain all glyphs,
+         *      see reserve() for more information.
+         */
+        BatchTextRenderer<dimensions>* setText(UnsignedInt id, const std::string& text);
+
+        /** @brief Transformation of text with given ID */
+        inline typename DimensionTraits<dimensions>::MatrixType transformation(UnsignedInt id) const {
+            return texts[id].transformation;
+        }
+
+        /**
+         * @brief Set text transformation
+         * @return Pointer to self (for method chaining)
+         *
+         * The buffer is updated on next update().
+         */
+        BatchTextRenderer<dimensions>* setTransformation(UnsignedInt id, const typename DimensionTraits<dimensions>::MatrixType& transformation);
+
+        /** @brief Color of text with given ID */
+        inline Color4<> color(UnsignedInt id) const {
+            return texts[id].color;
+        }
+
+        /**
+         * @brief Set text color
+         * @return Pointer to self (for method chaining)
+         *
+         * The buffer is updated on next update().
+         */
+        BatchTextRenderer<dimensions>* setColor(UnsignedInt id, const Color4<>& color);
+
+        /**
+         * @brief Rectangle spanning text with given ID
+         *
+         * Without the transformation applied.
+         */
+        inline Rectangle rectangle(UnsignedInt id) const {
+            return texts[id].rectangle;
+        }
+
+        /**
+         * @brief Update the buffer
+         *
+         * Uploads changed texts to vertex buffer. Call before drawing the
+         * mesh. Does nothing if nothing changed.
+         */
+        void update();
+
+    private:
+        struct Entry {
+            std::string text;
+            typename DimensionTraits<dimensions>::MatrixType transformation;
+            Color4<> color;
+            Rectangle rectangle;
+            std::vector<Rectangle> quadPositions, textureCoordinates;
+            UnsignedInt offset, glyphCapacity;
+            bool dirty;
+        };
+
+        void MAGNUM_LOCAL layout(Entry& entry);
+        void MAGNUM_LOCAL place(Entry& entry, UnsignedInt glyphCapacity);
+        void MAGNUM_LOCAL compact();
+
+        AbstractFont* const font;
+        const GlyphCache* const cache;
+        Float size;
+        LayoutCache* _layoutCache;
+        TextLayouter* _layouter;
+
+        Mesh _mesh;
+        Buffer vertexBuffer;
+        UnsignedInt _capacity, _end;
+        bool _dirty;
+        std::vector<Entry> texts;
+
+        /* Ranges left after moved texts, filled with degenerate glyphs on
+           update() */
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> holes;
+};
+
+/** @brief Two-dimensional batch text renderer */
+typedef BatchTextRenderer<2> BatchTextRenderer2D;
+
+/** @brief Three-dimensional batch text renderer */
+typedef BatchTextRenderer<3> BatchTextRenderer3D;
+
 }}
 
 #endif
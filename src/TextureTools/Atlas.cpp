@@ -24,37 +24,206 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+
 #include "Math/Functions.h"
-#include "Math/Geometry/Rectangle.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding, const AtlasFlags flags): _size(size), _padding(padding), _flags(flags), _occupied(0), _nodes{{0, 0, size.x()}} {}
+
+std::vector<Rectanglei> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    /* Place the tallest textures first. If rotation is allowed, they will
+       be tried in both orientations, thus sort by the longer side instead. */
+    const bool allowRotation(_flags & AtlasFlag::AllowRotation);
+    std::vector<std::size_t> order(sizes.size());
+    for(std::size_t i = 0; i != order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&sizes, allowRotation](std::size_t a, std::size_t b) {
+        const Vector2i sa = allowRotation ? Vector2i(Math::max(sizes[a].x(), sizes[a].y()), Math::min(sizes[a].x(), sizes[a].y())) : sizes[a];
+        const Vector2i sb = allowRotation ? Vector2i(Math::max(sizes[b].x(), sizes[b].y()), Math::min(sizes[b].x(), sizes[b].y())) : sizes[b];
+        return sa.y() != sb.y() ? sa.y() > sb.y() : sa.x() > sb.x();
+    });
+
+    /* Backup of the state to restore if everything doesn't fit */
+    const std::vector<SkylineNode> nodes = _nodes;
+    const std::vector<Rectanglei> free = _free;
+    const Long occupied = _occupied;
+
+    std::vector<Rectanglei> atlas(sizes.size());
+    for(std::size_t i: order) {
+        Vector2i size = sizes[i];
+        Vector2i paddedSize = size + 2*_padding;
+
+        /* Empty textures don't occupy any space */
+        if(!size.product()) {
+            atlas[i] = Rectanglei::fromSize(_padding, size);
+            continue;
+        }
+
+        /* Fill holes after removed textures first, prefer the smaller one
+           if rotation is allowed */
+        Int freeRectangle = findFree(paddedSize);
+        if(allowRotation && size.x() != size.y()) {
+            const Int rotatedFreeRectangle = findFree({paddedSize.y(), paddedSize.x()});
+            if(rotatedFreeRectangle != -1 && (freeRectangle == -1 || _free[rotatedFreeRectangle].size().product() < _free[freeRectangle].size().product())) {
+                freeRectangle = rotatedFreeRectangle;
+                paddedSize = {paddedSize.y(), paddedSize.x()};
+                size = {size.y(), size.x()};
+            }
+        }
+
+        if(freeRectangle != -1) {
+            atlas[i] = Rectanglei::fromSize(_free[freeRectangle].bottomLeft()+_padding, size);
+            addFree(freeRectangle, paddedSize);
+            _occupied += Long(paddedSize.x())*paddedSize.y();
+            continue;
+        }
+
+        Vector2i position;
+        Int node = findSkyline(paddedSize, position);
+
+        /* Try rotated, use it if it ends lower */
+        if(allowRotation && size.x() != size.y()) {
+            const Vector2i rotatedPaddedSize(paddedSize.y(), paddedSize.x());
+            Vector2i rotatedPosition;
+            const Int rotatedNode = findSkyline(rotatedPaddedSize, rotatedPosition);
+            if(rotatedNode != -1 && (node == -1 || rotatedPosition.y() + rotatedPaddedSize.y() < position.y() + paddedSize.y())) {
+                node = rotatedNode;
+                position = rotatedPosition;
+                paddedSize = rotatedPaddedSize;
+                size = {size.y(), size.x()};
+            }
+        }
+
+        if(node == -1) {
+            _nodes = nodes;
+            _free = free;
+            _occupied = occupied;
+            return {};
+        }
+
+        addSkyline(node, position, paddedSize);
+        atlas[i] = Rectanglei::fromSize(position+_padding, size);
+        _occupied += Long(paddedSize.x())*paddedSize.y();
+    }
+
+    return atlas;
+}
+
+void AtlasPacker::remove(const Rectanglei& rectangle) {
+    if(!rectangle.size().product()) return;
+
+    const Rectanglei padded(rectangle.bottomLeft()-_padding, rectangle.topRight()+_padding);
+    _free.push_back(padded);
+    _occupied -= Long(padded.width())*padded.height();
+}
+
+void AtlasPacker::clear() {
+    _occupied = 0;
+    _nodes.assign(1, SkylineNode{0, 0, _size.x()});
+    _free.clear();
+}
+
+Int AtlasPacker::fitSkyline(std::size_t node, const Vector2i& size) const {
+    if(_nodes[node].x + size.x() > _size.x()) return -1;
+
+    Int y = _nodes[node].y;
+    for(Int widthLeft = size.x(); widthLeft > 0; widthLeft -= _nodes[node++].width) {
+        y = Math::max(y, _nodes[node].y);
+        if(y + size.y() > _size.y()) return -1;
+    }
+
+    return y;
+}
+
+Int AtlasPacker::findSkyline(const Vector2i& size, Vector2i& position) const {
+    Int best = -1;
+    Int bestTop = _size.y() + 1;
+    for(std::size_t i = 0; i != _nodes.size(); ++i) {
+        const Int y = fitSkyline(i, size);
+        if(y == -1 || y + size.y() >= bestTop) continue;
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+        best = i;
+        bestTop = y + size.y();
+        position = {_nodes[i].x, y};
+    }
 
-    std::vector<Rectanglei> atlas;
+    return best;
+}
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
+void AtlasPacker::addSkyline(const std::size_t node, const Vector2i& position, const Vector2i& size) {
+    _nodes.insert(_nodes.begin()+node, SkylineNode{position.x(), position.y() + size.y(), size.x()});
+
+    /* Shrink or remove nodes covered by the new one */
+    for(std::size_t i = node+1; i != _nodes.size(); ) {
+        const Int previousEnd = _nodes[i-1].x + _nodes[i-1].width;
+        if(_nodes[i].x >= previousEnd) break;
+
+        const Int shrink = previousEnd - _nodes[i].x;
+        _nodes[i].x += shrink;
+        _nodes[i].width -= shrink;
+        if(_nodes[i].width > 0) break;
+        _nodes.erase(_nodes.begin()+i);
+    }
+
+    /* Merge neighbors at the same height */
+    for(std::size_t i = (node ? node-1 : 0); i+1 < _nodes.size() && i <= node+1; ) {
+        if(_nodes[i].y == _nodes[i+1].y) {
+            _nodes[i].width += _nodes[i+1].width;
+            _nodes.erase(_nodes.begin()+i+1);
+        } else ++i;
+    }
+}
+
+Int AtlasPacker::findFree(const Vector2i& size) const {
+    Int best = -1;
+    Int bestArea = 0;
+    for(std::size_t i = 0; i != _free.size(); ++i) {
+        const Vector2i freeSize = _free[i].size();
+        if(freeSize.x() < size.x() || freeSize.y() < size.y()) continue;
+        if(best != -1 && freeSize.product() >= bestArea) continue;
+
+        best = i;
+        bestArea = freeSize.product();
+    }
+
+    return best;
+}
+
+void AtlasPacker::addFree(const std::size_t rectangle, const Vector2i& size) {
+    const Rectanglei free = _free[rectangle];
+    _free.erase(_free.begin()+rectangle);
+
+    /* Split the rest along the shorter leftover side so the larger of the
+       two remaining rectangles is as big as possible */
+    const Vector2i left = free.size() - size;
+    Rectanglei right, top;
+    if(left.x() > left.y()) {
+        right = {{free.left() + size.x(), free.bottom()}, free.topRight()};
+        top = {{free.left(), free.bottom() + size.y()}, {free.left() + size.x(), free.top()}};
+    } else {
+        right = {{free.left() + size.x(), free.bottom()}, {free.right(), free.bottom() + size.y()}};
+        top = {{free.left(), free.bottom() + size.y()}, free.topRight()};
+    }
+
+    if(right.size().product()) _free.push_back(right);
+    if(top.size().product()) _free.push_back(top);
+}
+
+std::vector<Rectanglei> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, const AtlasFlags flags, Float* const occupancy) {
+    if(occupancy) *occupancy = 0.0f;
+    if(sizes.empty()) return {};
+
+    AtlasPacker packer(atlasSize, padding, flags);
+    std::vector<Rectanglei> atlas = packer.add(sizes);
+    if(atlas.empty()) {
         Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
+                << "is too small to fit" << sizes.size()
                 << "textures. Generated atlas will be empty.";
         return atlas;
     }
 
-    /** @todo actual magic implementation, not this joke */
-
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Rectanglei::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
-
+    if(occupancy) *occupancy = packer.occupancy();
     return atlas;
 }
 
@@ -25,32 +25,164 @@
 */
 
 /** @file
- * @brief Function Magnum::TextureTools::atlas()
+ * @brief Class Magnum::TextureTools::AtlasPacker, function Magnum::TextureTools::atlas(), enum Magnum::TextureTools::AtlasFlag, enum set Magnum::TextureTools::AtlasFlags
  */
 
 #include <vector>
+#include <Containers/EnumSet.h>
 
-#include "Math/Vector2.h"
+#include "Math/Geometry/Rectangle.h"
 #include "Magnum.h"
 
 #include "magnumTextureToolsVisibility.h"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief %Atlas packing flag
+
+@see AtlasFlags, atlas(), AtlasPacker
+*/
+enum class AtlasFlag: UnsignedByte {
+    /**
+     * Allow rotating the textures by 90 degrees if they fit better. Rotated
+     * textures have width and height swapped in the returned rectangle.
+     */
+    AllowRotation = 1 << 0
+};
+
+/**
+@brief %Atlas packing flags
+
+@see atlas(), AtlasPacker
+*/
+typedef Corrade::Containers::EnumSet<AtlasFlag, UnsignedByte> AtlasFlags;
+
+CORRADE_ENUMSET_OPERATORS(AtlasFlags)
+
+/**
+@brief Incremental texture atlas packer
+
+Keeps track of free space in the atlas between calls to add(), so textures can
+be added on demand without repacking the already present ones. Textures can
+be also removed from the atlas, their area is then reused for subsequently
+added textures.
+
+Uses the same skyline bottom-left heuristic as atlas(). Removed areas are
+kept in a list of free rectangles, which are filled first. When a texture is
+placed into a free rectangle, the rest of it is split into two smaller free
+rectangles. Free rectangles are never merged, thus removing and adding many
+differently sized textures fragments the free space.
+@see Text::GlyphCache
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each texture
+         * @param flags     Packing flags
+         *
+         * See atlas() for more information about padding.
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = Vector2i(), AtlasFlags flags = AtlasFlags());
+
+        /** @brief %Atlas size */
+        inline Vector2i size() const { return _size; }
+
+        /** @brief Padding around each texture */
+        inline Vector2i padding() const { return _padding; }
+
+        /** @brief Packing flags */
+        inline AtlasFlags flags() const { return _flags; }
+
+        /**
+         * @brief Occupancy
+         *
+         * Ratio of atlas area occupied by the (padded) textures.
+         */
+        inline Float occupancy() const {
+            return Float(_occupied)/(Float(_size.x())*_size.y());
+        }
+
+        /**
+         * @brief Add textures
+         * @param sizes     Sizes of the textures
+         * @return Rectangles of the textures without padding, in the same
+         *      order as @p sizes.
+         *
+         * Either all textures are added or, if they cannot fit, none of them
+         * is added and empty vector is returned.
+         */
+        std::vector<Rectanglei> add(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Remove texture
+         * @param rectangle     Rectangle previously returned from add()
+         *
+         * The area (including padding) is freed for subsequently added
+         * textures.
+         */
+        void remove(const Rectanglei& rectangle);
+
+        /** @brief Remove all textures */
+        void clear();
+
+    private:
+        /* Horizontal segment of the skyline, everything below it is
+           occupied */
+        struct SkylineNode {
+            Int x, y, width;
+        };
+
+        /* Lowest bottom for given size starting at given node or -1 */
+        Int fitSkyline(std::size_t node, const Vector2i& size) const;
+
+        /* Find lowest position for given size, returns node index or -1 */
+        Int findSkyline(const Vector2i& size, Vector2i& position) const;
+
+        /* Occupy given area starting at given node */
+        void addSkyline(std::size_t node, const Vector2i& position, const Vector2i& size);
+
+        /* Find smallest free rectangle fitting given size or -1 */
+        Int findFree(const Vector2i& size) const;
+
+        /* Occupy given size in given free rectangle */
+        void addFree(std::size_t rectangle, const Vector2i& size);
+
+        Vector2i _size, _padding;
+        AtlasFlags _flags;
+        Long _occupied;
+        std::vector<SkylineNode> _nodes;
+        std::vector<Rectanglei> _free;
+};
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
+@param flags        Packing flags
+@param occupancy    If not `nullptr`, ratio of atlas area occupied by the
+    (padded) textures is saved there
 
 Packs many small textures into one larger. If the textures cannot be packed
 into required size, empty vector is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
-padding.
+padding. If @ref AtlasFlag "AtlasFlag::AllowRotation" is set, some returned
+sizes may have width and height swapped, meaning the texture should be rotated
+by 90 degrees.
+
+The textures are packed using skyline bottom-left heuristic, sorted by height
+from the tallest, which gives good results for textures of widely varying
+sizes, such as font glyphs. Placing one texture is linear in number of
+skyline segments, which is bounded by atlas width, thus packing even tens of
+thousands of textures is fast.
+@see AtlasPacker
 */
-std::vector<Rectanglei> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
+std::vector<Rectanglei> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i(), AtlasFlags flags = AtlasFlags(), Float* occupancy = nullptr);
 
 }}
 
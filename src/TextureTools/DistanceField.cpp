@@ -24,11 +24,20 @@
 
 #include "TextureTools/DistanceField.h"
 
+#include <algorithm>
+#include <cmath>
+#include <Utility/Assert.h>
 #include <Utility/Resource.h>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Math/Functions.h"
 #include "Math/Geometry/Rectangle.h"
 #include "AbstractShaderProgram.h"
 #include "Extensions.h"
 #include "Framebuffer.h"
+#include "Image.h"
 #include "Mesh.h"
 #include "Shader.h"
 #include "Texture.h"
@@ -80,6 +89,93 @@ DistanceFieldShader::DistanceFieldShader() {
     link();
 }
 
+/* Larger than any squared distance in image of sane size */
+constexpr Float Infinity = 1.0e20f;
+
+/* Minimal count of lines processed by one thread, below that the overhead of
+   spawning the thread is larger than the gain */
+constexpr std::size_t MinimalChunkSize = 32;
+
+/* Call function(begin, end) on ranges covering [0, count) in parallel */
+template<class F> void parallel(const std::size_t count, F function) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const std::size_t threadCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), count/MinimalChunkSize);
+    #else
+    const std::size_t threadCount = 1;
+    #endif
+
+    if(threadCount <= 1) {
+        function(0, count);
+        return;
+    }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Spawn threads for all chunks except the last one, which is processed
+       on current thread */
+    const std::size_t chunkSize = (count + threadCount - 1)/threadCount;
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for(std::size_t i = 0; i != threadCount - 1; ++i)
+        threads.emplace_back(function, i*chunkSize, (i + 1)*chunkSize);
+
+    function((threadCount - 1)*chunkSize, count);
+    for(std::thread& thread: threads) thread.join();
+    #endif
+}
+
+/* One-dimensional squared distance transform of sampled function, i.e. lower
+   envelope of parabolas rooted at (q, f[q]). The `v` array must have n
+   elements, `z` n + 1 elements. */
+void transform(const Float* const f, Float* const d, const Int n, Int* const v, Float* const z) {
+    Int k = 0;
+    v[0] = 0;
+    z[0] = -Infinity;
+    z[1] = Infinity;
+    for(Int q = 1; q < n; ++q) {
+        Float s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2*(q - v[k]));
+        while(s <= z[k]) {
+            --k;
+            s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2*(q - v[k]));
+        }
+
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k+1] = Infinity;
+    }
+
+    k = 0;
+    for(Int q = 0; q < n; ++q) {
+        while(z[k+1] < q) ++k;
+        d[q] = (q - v[k])*(q - v[k]) + f[v[k]];
+    }
+}
+
+/* Squared distance transform of given grids in place, first along columns,
+   then along rows */
+void transform(std::vector<Float>* const grids, const std::size_t gridCount, const Vector2i& size) {
+    parallel(size.x(), [grids, gridCount, &size](std::size_t begin, std::size_t end) {
+        std::vector<Float> f(size.y()), d(size.y()), z(size.y() + 1);
+        std::vector<Int> v(size.y());
+        for(std::size_t g = 0; g != gridCount; ++g) for(std::size_t x = begin; x != end; ++x) {
+            Float* const column = grids[g].data() + x;
+            for(Int y = 0; y != size.y(); ++y) f[y] = column[y*size.x()];
+            transform(f.data(), d.data(), size.y(), v.data(), z.data());
+            for(Int y = 0; y != size.y(); ++y) column[y*size.x()] = d[y];
+        }
+    });
+
+    parallel(size.y(), [grids, gridCount, &size](std::size_t begin, std::size_t end) {
+        std::vector<Float> d(size.x()), z(size.x() + 1);
+        std::vector<Int> v(size.x());
+        for(std::size_t g = 0; g != gridCount; ++g) for(std::size_t y = begin; y != end; ++y) {
+            Float* const row = grids[g].data() + y*size.x();
+            transform(row, d.data(), size.x(), v.data(), z.data());
+            std::copy(d.begin(), d.end(), row);
+        }
+    });
+}
+
 }
 
 void distanceField(Texture2D* input, Texture2D* output, const Rectanglei& rectangle, const Int radius) {
@@ -104,4 +200,51 @@ void distanceField(Texture2D* input, Texture2D* output, const Rectanglei& rectan
         ->draw();
 }
 
+void distanceField(const Image2D* const input, Image2D* const output, const Rectanglei& rectangle, const Int radius) {
+    CORRADE_ASSERT(input->type() == AbstractImage::Type::UnsignedByte,
+        "TextureTools::distanceField(): expected input image of unsigned byte type", );
+    CORRADE_ASSERT(output->type() == AbstractImage::Type::UnsignedByte && AbstractImage::pixelSize(output->format(), output->type()) == 1,
+        "TextureTools::distanceField(): expected output image with one-byte pixels", );
+    CORRADE_ASSERT(rectangle.left() >= 0 && rectangle.bottom() >= 0 && rectangle.right() <= output->size().x() && rectangle.top() <= output->size().y(),
+        "TextureTools::distanceField(): rectangle" << rectangle << "doesn't fit into output image of size" << output->size(), );
+
+    /* Distances to nearest pixel inside and outside, with one-pixel border
+       outside around the input */
+    const Vector2i inputSize = input->size();
+    const Vector2i size = inputSize + Vector2i(2);
+    std::vector<Float> grids[2]{
+        std::vector<Float>(size.product(), Infinity),
+        std::vector<Float>(size.product(), 0.0f)
+    };
+    const std::size_t inputPixelSize = AbstractImage::pixelSize(input->format(), input->type());
+    for(Int y = 0; y != inputSize.y(); ++y) for(Int x = 0; x != inputSize.x(); ++x) {
+        if(input->data()[(y*inputSize.x() + x)*inputPixelSize] <= 127) continue;
+
+        const std::size_t i = (y + 1)*size.x() + x + 1;
+        grids[0][i] = 0.0f;
+        grids[1][i] = Infinity;
+    }
+
+    transform(grids, 2, size);
+
+    /* Sample the distances, same as in the shader */
+    const Vector2 scaling = Vector2(inputSize)/Vector2(rectangle.size());
+    const Float maxDistance = Float(radius + 1);
+    parallel(rectangle.height(), [&](std::size_t begin, std::size_t end) {
+        for(Int y = begin; y != Int(end); ++y) {
+            UnsignedByte* const row = output->data() + (rectangle.bottom() + y)*output->size().x() + rectangle.left();
+            for(Int x = 0; x != rectangle.width(); ++x) {
+                const Vector2i position(Vector2(x, y)*scaling);
+                const std::size_t i = (position.y() + 1)*size.x() + position.x() + 1;
+
+                /* Inside pixel has zero distance to nearest inside pixel */
+                const bool isInside = grids[0][i] == 0.0f;
+                const Float distance = std::min(std::sqrt(grids[isInside ? 1 : 0][i]), maxDistance);
+                const Float value = (isInside ? distance : -distance)/(2.0f*maxDistance) + 0.5f;
+                row[x] = UnsignedByte(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+            }
+        }
+    });
+}
+
 }}
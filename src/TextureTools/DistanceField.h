@@ -65,10 +65,39 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is GPU-only implementation, so it expects active context.
+@attention This is GPU-only implementation, so it expects active context. See
+    distanceField(const Image2D*, Image2D*, const Rectanglei&, Int) for CPU
+    implementation.
 */
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D* input, Texture2D* output, const Rectanglei& rectangle, Int radius);
 
+/**
+@brief Create signed distance field on CPU
+@param input        Input image
+@param output       Output image
+@param rectangle    Rectangle in output image where to render
+@param radius       Max lookup radius in input image
+
+Same as distanceField(Texture2D*, Texture2D*, const Rectanglei&, Int), but
+doesn't need any GL context, so it can be used e.g. for offline processing.
+First byte of each pixel of @p input is used as binary image, the image must
+have @ref AbstractImage::Type "Type::UnsignedByte" type. Pixels outside of
+@p input are treated as zero. The output image must have one-byte pixels of
+@ref AbstractImage::Type "Type::UnsignedByte" type and contain whole
+@p rectangle, other pixels of it are left untouched.
+
+Instead of searching the surroundings of each pixel, exact squared Euclidean
+distance transform of the whole input is computed in two separable passes,
+thus the time is linear in input pixel count and independent of @p radius.
+Both passes and the final conversion are done in parallel on all available
+hardware threads.
+
+Based on: *Pedro F. Felzenszwalb, Daniel P. Huttenlocher - Distance Transforms
+of Sampled Functions, Theory of Computing, 2012,
+http://cs.brown.edu/~pff/papers/dt-final.pdf*
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT distanceField(const Image2D* input, Image2D* output, const Rectanglei& rectangle, Int radius);
+
 }}
 
 #endif
@@ -0,0 +1,444 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MultiChannelDistanceField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Utility/Assert.h>
+
+#include "Math/Constants.h"
+#include "Math/Functions.h"
+#include "Math/Geometry/Rectangle.h"
+#include "Image.h"
+#include "TextureTools/Outline.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+constexpr Float Infinity = 1.0e20f;
+constexpr Float Epsilon = 1.0e-12f;
+
+/* Channel bitmask assigned to each edge */
+enum: UnsignedByte {
+    Black = 0,
+    Red = 1,
+    Green = 2,
+    Yellow = 3,
+    Blue = 4,
+    Magenta = 5,
+    Cyan = 6,
+    White = 7
+};
+
+struct ColoredEdge {
+    Outline::Edge edge;
+    UnsignedByte color;
+};
+
+/* Distance with sign, ties broken by how much the direction from the nearest
+   point diverges from the edge direction -- the more perpendicular, the
+   closer */
+struct SignedDistance {
+    inline constexpr SignedDistance(Float distance = -Infinity, Float dot = 1.0f): distance(distance), dot(dot) {}
+
+    inline bool operator<(const SignedDistance& other) const {
+        return std::abs(distance) < std::abs(other.distance) ||
+            (std::abs(distance) == std::abs(other.distance) && dot < other.dot);
+    }
+
+    Float distance, dot;
+};
+
+inline Float nonZeroSign(Float value) { return value > 0.0f ? 1.0f : -1.0f; }
+
+inline Float median(Float a, Float b, Float c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+/* Real roots of a*x^2 + b*x + c */
+Int solveQuadratic(Float* x, const Float a, const Float b, const Float c) {
+    if(std::abs(a) < Epsilon) {
+        if(std::abs(b) < Epsilon) return 0;
+        x[0] = -c/b;
+        return 1;
+    }
+
+    const Float discriminant = b*b - 4.0f*a*c;
+    if(discriminant > 0.0f) {
+        const Float root = std::sqrt(discriminant);
+        x[0] = (-b + root)/(2.0f*a);
+        x[1] = (-b - root)/(2.0f*a);
+        return 2;
+    } else if(discriminant == 0.0f) {
+        x[0] = -b/(2.0f*a);
+        return 1;
+    } else return 0;
+}
+
+/* Real roots of a*x^3 + b*x^2 + c*x + d */
+Int solveCubic(Float* x, const Float a, Float b, Float c, Float d) {
+    if(std::abs(a) < Epsilon) return solveQuadratic(x, b, c, d);
+
+    /* Normalized form x^3 + b*x^2 + c*x + d */
+    b /= a;
+    c /= a;
+    d /= a;
+    const Float b2 = b*b;
+    const Float q = (b2 - 3.0f*c)/9.0f;
+    const Float r = (b*(2.0f*b2 - 9.0f*c) + 27.0f*d)/54.0f;
+    const Float r2 = r*r;
+    const Float q3 = q*q*q;
+
+    if(r2 < q3) {
+        const Float t = std::acos(Math::clamp(r/std::sqrt(q3), -1.0f, 1.0f));
+        const Float m = -2.0f*std::sqrt(q);
+        x[0] = m*std::cos(t/3.0f) - b/3.0f;
+        x[1] = m*std::cos((t + 2.0f*Constants::pi())/3.0f) - b/3.0f;
+        x[2] = m*std::cos((t - 2.0f*Constants::pi())/3.0f) - b/3.0f;
+        return 3;
+    }
+
+    Float u = -std::pow(std::abs(r) + std::sqrt(r2 - q3), 1.0f/3.0f);
+    if(r < 0.0f) u = -u;
+    const Float v = u == 0.0f ? 0.0f : q/u;
+    x[0] = (u + v) - b/3.0f;
+    x[1] = -0.5f*(u + v) - b/3.0f;
+    return std::abs(0.5f*std::sqrt(3.0f)*(u - v)) < 1.0e-7f ? 2 : 1;
+}
+
+/* Split the edge at given position using de Casteljau's algorithm */
+void split(const Outline::Edge& edge, const Float t, Outline::Edge& first, Outline::Edge& second) {
+    first.type = second.type = edge.type;
+    const Vector2* const p = edge.points;
+    switch(edge.type) {
+        case Outline::EdgeType::Linear: {
+            const Vector2 m = Math::lerp(p[0], p[1], t);
+            first.points[0] = p[0];
+            first.points[1] = second.points[0] = m;
+            second.points[1] = p[1];
+        } break;
+
+        case Outline::EdgeType::Quadratic: {
+            const Vector2 a = Math::lerp(p[0], p[1], t);
+            const Vector2 b = Math::lerp(p[1], p[2], t);
+            const Vector2 m = Math::lerp(a, b, t);
+            first.points[0] = p[0];
+            first.points[1] = a;
+            first.points[2] = second.points[0] = m;
+            second.points[1] = b;
+            second.points[2] = p[2];
+        } break;
+
+        case Outline::EdgeType::Cubic: {
+            const Vector2 a = Math::lerp(p[0], p[1], t);
+            const Vector2 b = Math::lerp(p[1], p[2], t);
+            const Vector2 c = Math::lerp(p[2], p[3], t);
+            const Vector2 ab = Math::lerp(a, b, t);
+            const Vector2 bc = Math::lerp(b, c, t);
+            const Vector2 m = Math::lerp(ab, bc, t);
+            first.points[0] = p[0];
+            first.points[1] = a;
+            first.points[2] = ab;
+            first.points[3] = second.points[0] = m;
+            second.points[1] = bc;
+            second.points[2] = c;
+            second.points[3] = p[3];
+        } break;
+    }
+}
+
+/* Next color so that two consecutive edges share exactly one channel */
+UnsignedByte switchColor(const UnsignedByte color, UnsignedInt& seed, const UnsignedByte banned = Black) {
+    const UnsignedByte combined = color & banned;
+    if(combined == Red || combined == Green || combined == Blue)
+        return combined ^ White;
+
+    if(color == Black || color == White) {
+        constexpr UnsignedByte start[]{Cyan, Magenta, Yellow};
+        const UnsignedByte next = start[seed%3];
+        seed /= 3;
+        return next;
+    }
+
+    const UnsignedByte shifted = color << (1 + (seed & 1));
+    seed >>= 1;
+    return (shifted | shifted >> 3) & White;
+}
+
+/* Whether the edges meet in a sharp corner, i.e. direction changes by more
+   than ~3 degrees */
+bool isCorner(const Outline::Edge& previous, const Outline::Edge& next) {
+    const Vector2 a = previous.direction(1.0f).normalized();
+    const Vector2 b = next.direction(0.0f).normalized();
+    return Vector2::dot(a, b) <= 0.0f || std::abs(Vector2::cross(a, b)) > 0.1411200081f;
+}
+
+/* Color all edges of one contour, simplified version of msdfgen's
+   edgeColoringSimple() */
+void colorContour(const Outline::Contour& contour, UnsignedInt& seed, std::vector<ColoredEdge>& out) {
+    std::vector<std::size_t> corners;
+    for(std::size_t i = 0; i != contour.size(); ++i)
+        if(isCorner(contour[i ? i - 1 : contour.size() - 1], contour[i]))
+            corners.push_back(i);
+
+    /* Smooth contour, all channels have the same distance */
+    if(corners.empty()) {
+        for(const Outline::Edge& edge: contour) out.push_back({edge, White});
+        return;
+    }
+
+    /* "Teardrop" with only one corner, color the contour in three parts
+       starting at the corner, splitting the edges if there aren't enough of
+       them */
+    if(corners.size() == 1) {
+        UnsignedByte colors[3];
+        colors[0] = switchColor(White, seed);
+        colors[1] = White;
+        colors[2] = switchColor(colors[0], seed);
+
+        const std::size_t corner = corners.front();
+        if(contour.size() >= 3) {
+            for(std::size_t i = 0; i != contour.size(); ++i) {
+                /* Position of the edge relative to the corner mapped to
+                   three parts */
+                const std::size_t part = std::size_t(3 + 2.875f*i/(contour.size() - 1) - 1.4375f + 0.5f) - 2;
+                out.push_back({contour[(corner + i)%contour.size()], colors[part]});
+            }
+        } else {
+            Outline::Edge parts[6];
+            for(std::size_t i = 0; i != contour.size(); ++i) {
+                Outline::Edge rest;
+                split(contour[(corner + i)%contour.size()], 1.0f/3.0f, parts[3*i], rest);
+                split(rest, 0.5f, parts[3*i + 1], parts[3*i + 2]);
+            }
+            for(std::size_t i = 0; i != 3*contour.size(); ++i)
+                out.push_back({parts[i], colors[contour.size() == 1 ? i : i/2]});
+        }
+        return;
+    }
+
+    /* Multiple corners, switch color at each of them */
+    const std::size_t start = corners.front();
+    UnsignedByte color = switchColor(White, seed);
+    const UnsignedByte initialColor = color;
+    std::size_t spline = 0;
+    for(std::size_t i = 0; i != contour.size(); ++i) {
+        const std::size_t index = (start + i)%contour.size();
+        if(spline + 1 < corners.size() && corners[spline + 1] == index) {
+            ++spline;
+            /* Last spline must differ from the first one too */
+            color = switchColor(color, seed, spline == corners.size() - 1 ? initialColor : UnsignedByte(Black));
+        }
+        out.push_back({contour[index], color});
+    }
+}
+
+/* Signed distance of a point to an edge, also returning position of the
+   nearest point on the edge (outside of [0, 1] if the nearest point is an
+   endpoint and the point lies beyond it). Positive distance is on the left
+   of edge direction. */
+SignedDistance signedDistance(const Outline::Edge& edge, const Vector2& point, Float& param) {
+    const Vector2* const p = edge.points;
+
+    if(edge.type == Outline::EdgeType::Linear) {
+        const Vector2 aq = point - p[0];
+        const Vector2 ab = p[1] - p[0];
+        param = Vector2::dot(aq, ab)/ab.dot();
+        const Vector2 eq = (param > 0.5f ? p[1] : p[0]) - point;
+        const Float endpointDistance = eq.length();
+        if(param > 0.0f && param < 1.0f) {
+            const Float orthoDistance = Vector2::cross(ab, aq)/ab.length();
+            if(std::abs(orthoDistance) < endpointDistance)
+                return SignedDistance(orthoDistance, 0.0f);
+        }
+        return SignedDistance(nonZeroSign(Vector2::cross(ab, aq))*endpointDistance,
+            std::abs(Vector2::dot(ab.normalized(), eq.normalized())));
+    }
+
+    /* Endpoints */
+    const Vector2 start = p[0];
+    const Vector2 end = edge.end();
+    Vector2 direction = edge.direction(0.0f);
+    Float minDistance = nonZeroSign(Vector2::cross(direction, point - start))*(point - start).length();
+    param = Vector2::dot(point - start, direction)/direction.dot();
+    direction = edge.direction(1.0f);
+    {
+        const Float distance = (point - end).length();
+        if(distance < std::abs(minDistance)) {
+            minDistance = nonZeroSign(Vector2::cross(direction, point - end))*distance;
+            param = 1.0f + Vector2::dot(point - end, direction)/direction.dot();
+        }
+    }
+
+    const Vector2 qa = p[0] - point;
+    const Vector2 ab = p[1] - p[0];
+    const Vector2 br = p[2] - p[1] - ab;
+
+    /* Quadratic curve, solve the cubic equation for the points where the
+       curve derivative is perpendicular to direction to the point */
+    if(edge.type == Outline::EdgeType::Quadratic) {
+        Float t[3];
+        const Int count = solveCubic(t, br.dot(), 3.0f*Vector2::dot(ab, br),
+            2.0f*ab.dot() + Vector2::dot(qa, br), Vector2::dot(qa, ab));
+        for(Int i = 0; i != count; ++i) {
+            if(t[i] <= 0.0f || t[i] >= 1.0f) continue;
+            const Vector2 qe = qa + ab*(2.0f*t[i]) + br*(t[i]*t[i]);
+            const Float distance = qe.length();
+            if(distance <= std::abs(minDistance)) {
+                minDistance = nonZeroSign(Vector2::cross(ab + br*t[i], -qe))*distance;
+                param = t[i];
+            }
+        }
+
+    /* Cubic curve, the equation is of fifth degree, thus approximate it with
+       Newton iterations from a few starting points */
+    } else {
+        const Vector2 as = (p[3] - p[2]) - (p[2] - p[1]) - br;
+        for(Int i = 0; i <= 4; ++i) {
+            Float t = Float(i)/4.0f;
+            Vector2 qe = qa + ab*(3.0f*t) + br*(3.0f*t*t) + as*(t*t*t);
+            for(Int step = 0; step != 4; ++step) {
+                const Vector2 d1 = ab*3.0f + br*(6.0f*t) + as*(3.0f*t*t);
+                const Vector2 d2 = br*6.0f + as*(6.0f*t);
+                const Float denominator = d1.dot() + Vector2::dot(qe, d2);
+                if(denominator == 0.0f) break;
+                t -= Vector2::dot(qe, d1)/denominator;
+                if(t <= 0.0f || t >= 1.0f) break;
+                qe = qa + ab*(3.0f*t) + br*(3.0f*t*t) + as*(t*t*t);
+                const Float distance = qe.length();
+                if(distance < std::abs(minDistance)) {
+                    minDistance = nonZeroSign(Vector2::cross(edge.direction(t), -qe))*distance;
+                    param = t;
+                }
+            }
+        }
+    }
+
+    if(param >= 0.0f && param <= 1.0f)
+        return SignedDistance(minDistance, 0.0f);
+    if(param < 0.5f)
+        return SignedDistance(minDistance, std::abs(Vector2::dot(edge.direction(0.0f).normalized(), (start - point).normalized())));
+    return SignedDistance(minDistance, std::abs(Vector2::dot(edge.direction(1.0f).normalized(), (end - point).normalized())));
+}
+
+/* Extend the edge beyond its endpoints to a ray, so the distance field is
+   not rounded at corners */
+void pseudoDistance(const Outline::Edge& edge, const Vector2& point, SignedDistance& distance, const Float param) {
+    if(param < 0.0f) {
+        const Vector2 direction = edge.direction(0.0f).normalized();
+        const Vector2 aq = point - edge.points[0];
+        if(Vector2::dot(aq, direction) < 0.0f) {
+            const Float pseudoDistance = Vector2::cross(direction, aq);
+            if(std::abs(pseudoDistance) <= std::abs(distance.distance))
+                distance = SignedDistance(pseudoDistance, 0.0f);
+        }
+    } else if(param > 1.0f) {
+        const Vector2 direction = edge.direction(1.0f).normalized();
+        const Vector2 bq = point - edge.end();
+        if(Vector2::dot(bq, direction) > 0.0f) {
+            const Float pseudoDistance = Vector2::cross(direction, bq);
+            if(std::abs(pseudoDistance) <= std::abs(distance.distance))
+                distance = SignedDistance(pseudoDistance, 0.0f);
+        }
+    }
+}
+
+/* Twice the signed area of the control polygon, positive for
+   counterclockwise contours */
+Float signedArea(const Outline::Contour& contour) {
+    Float area = 0.0f;
+    for(const Outline::Edge& edge: contour)
+        for(std::size_t i = 0; i != std::size_t(edge.type) + 1; ++i)
+            area += Vector2::cross(edge.points[i], edge.points[i + 1]);
+    return area;
+}
+
+inline UnsignedByte pack(const Float distance, const Float radius) {
+    return UnsignedByte(Math::clamp(distance/(2.0f*radius) + 0.5f, 0.0f, 1.0f)*255.0f + 0.5f);
+}
+
+}
+
+void multiChannelDistanceField(const Outline& outline, const Rectangle& area, Image2D* const output, const Rectanglei& rectangle, const Float radius) {
+    const std::size_t pixelSize = AbstractImage::pixelSize(output->format(), output->type());
+    CORRADE_ASSERT(output->type() == AbstractImage::Type::UnsignedByte && (pixelSize == 3 || pixelSize == 4),
+        "TextureTools::multiChannelDistanceField(): expected output image with three or four one-byte channels", );
+    CORRADE_ASSERT(rectangle.left() >= 0 && rectangle.bottom() >= 0 && rectangle.right() <= output->size().x() && rectangle.top() <= output->size().y(),
+        "TextureTools::multiChannelDistanceField(): rectangle" << rectangle << "doesn't fit into output image of size" << output->size(), );
+
+    /* Color the edges, find orientation from the largest contour */
+    std::vector<ColoredEdge> edges;
+    UnsignedInt seed = 0;
+    Float largestArea = 0.0f;
+    for(const Outline::Contour& contour: outline.contours()) {
+        colorContour(contour, seed, edges);
+        const Float contourArea = signedArea(contour);
+        if(std::abs(contourArea) > std::abs(largestArea)) largestArea = contourArea;
+    }
+    const Float orientation = largestArea < 0.0f ? -1.0f : 1.0f;
+
+    const Vector2 scaling = area.size()/Vector2(rectangle.size());
+    for(Int y = 0; y != rectangle.height(); ++y) {
+        UnsignedByte* const row = output->data() + ((rectangle.bottom() + y)*output->size().x() + rectangle.left())*pixelSize;
+        for(Int x = 0; x != rectangle.width(); ++x) {
+            const Vector2 point = area.bottomLeft() + (Vector2(x, y) + Vector2(0.5f))*scaling;
+
+            /* Nearest edge overall and for each channel */
+            SignedDistance minDistance(-Infinity), channelDistances[3];
+            const Outline::Edge* channelEdges[3]{};
+            Float channelParams[3]{};
+            for(const ColoredEdge& edge: edges) {
+                Float param;
+                const SignedDistance distance = signedDistance(edge.edge, point, param);
+                if(distance < minDistance) minDistance = distance;
+                for(Int i = 0; i != 3; ++i) {
+                    if(!(edge.color & (1 << i)) || !(distance < channelDistances[i])) continue;
+                    channelDistances[i] = distance;
+                    channelEdges[i] = &edge.edge;
+                    channelParams[i] = param;
+                }
+            }
+
+            Float channels[3];
+            for(Int i = 0; i != 3; ++i) {
+                if(channelEdges[i])
+                    pseudoDistance(*channelEdges[i], point, channelDistances[i], channelParams[i]);
+                channels[i] = orientation*(channelEdges[i] ? channelDistances[i] : minDistance).distance;
+            }
+
+            /* Replace clashing channels with true distance */
+            const Float distance = orientation*minDistance.distance;
+            if((median(channels[0], channels[1], channels[2]) > 0.0f) != (distance > 0.0f))
+                channels[0] = channels[1] = channels[2] = distance;
+
+            UnsignedByte* const pixel = row + x*pixelSize;
+            for(Int i = 0; i != 3; ++i) pixel[i] = pack(channels[i], radius);
+            if(pixelSize == 4) pixel[3] = pack(distance, radius);
+        }
+    }
+}
+
+}}
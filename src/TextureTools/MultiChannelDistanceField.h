@@ -0,0 +1,79 @@
+#ifndef Magnum_TextureTools_MultiChannelDistanceField_h
+#define Magnum_TextureTools_MultiChannelDistanceField_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function Magnum::TextureTools::multiChannelDistanceField()
+ */
+
+#include "Magnum.h"
+
+#include "TextureTools/magnumTextureToolsVisibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+class Outline;
+
+/**
+@brief Create multi-channel signed distance field from outline
+@param outline      Input outline
+@param area         Area of the outline which is rendered
+@param output       Output image
+@param rectangle    Rectangle in output image where to render
+@param radius       Max distance in outline units
+
+Unlike distanceField(), which produces single-channel field from binary image,
+this function computes the distances directly from vector outline and stores
+them in three channels. Each outline edge is assigned two of the channels so
+that edges meeting in a sharp corner don't share more than one of them. The
+distance of each channel is then a (pseudo)distance to nearest edge of given
+channel and median of the three channels reconstructs the original shape
+including sharp corners even when magnified, which single-channel distance
+fields always round. Thus the field can be rendered in considerably lower
+resolution for the same quality.
+
+@p area of the outline is mapped to @p rectangle of @p output, the distance
+is sampled in pixel centers. Signed distance is normalized from
+[-@p radius, @p radius] to [0, 1], values above `0.5` being inside. The output
+image must be of @ref AbstractImage::Type "Type::UnsignedByte" type with three
+or four channels, other pixels of it are left untouched. If the image has four
+channels, the fourth channel is filled with true (single-channel) signed
+distance.
+
+Contours are expected to have consistent orientation, as is the case of font
+glyphs. The orientation is detected from the contour with the largest area,
+which is treated as outer one. Pixels where the median would give different
+sign than the true distance (e.g. at clashing edges) are replaced with the
+true distance.
+
+Based on: *Viktor Chlumský - Shape Decomposition for Multi-channel Distance
+Fields, 2015, https://github.com/Chlumsky/msdfgen*
+@see Shaders::DistanceFieldVector
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT multiChannelDistanceField(const Outline& outline, const Rectangle& area, Image2D* output, const Rectanglei& rectangle, Float radius);
+
+}}
+
+#endif
@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Outline.h"
+
+#include "Math/Functions.h"
+
+namespace Magnum { namespace TextureTools {
+
+Vector2 Outline::Edge::point(const Float t) const {
+    const Float s = 1.0f - t;
+    switch(type) {
+        case EdgeType::Linear:
+            return points[0]*s + points[1]*t;
+        case EdgeType::Quadratic:
+            return points[0]*(s*s) + points[1]*(2.0f*s*t) + points[2]*(t*t);
+        case EdgeType::Cubic:
+            return points[0]*(s*s*s) + points[1]*(3.0f*s*s*t) + points[2]*(3.0f*s*t*t) + points[3]*(t*t*t);
+    }
+
+    return {};
+}
+
+Vector2 Outline::Edge::direction(const Float t) const {
+    const Float s = 1.0f - t;
+    switch(type) {
+        case EdgeType::Linear:
+            return points[1] - points[0];
+        case EdgeType::Quadratic: {
+            const Vector2 direction = (points[1] - points[0])*(2.0f*s) + (points[2] - points[1])*(2.0f*t);
+            /* Degenerate control point coinciding with the endpoint */
+            return direction.dot() == 0.0f ? points[2] - points[0] : direction;
+        }
+        case EdgeType::Cubic: {
+            const Vector2 direction = (points[1] - points[0])*(3.0f*s*s) + (points[2] - points[1])*(6.0f*s*t) + (points[3] - points[2])*(3.0f*t*t);
+            if(direction.dot() != 0.0f) return direction;
+            /* Degenerate control points coinciding with the endpoints */
+            return t < 0.5f ? points[2] - points[0] : points[3] - points[1];
+        }
+    }
+
+    return {};
+}
+
+Outline::Outline(): _closingEdge(false), _newContour(true) {}
+
+Rectangle Outline::bounds() const {
+    if(_contours.empty()) return {};
+
+    Vector2 min = _contours.front().front().points[0];
+    Vector2 max = min;
+    for(const Contour& contour: _contours) for(const Edge& edge: contour) {
+        for(std::size_t i = 0; i != std::size_t(edge.type) + 2; ++i) {
+            min = Math::min(min, edge.points[i]);
+            max = Math::max(max, edge.points[i]);
+        }
+    }
+
+    return {min, max};
+}
+
+Outline* Outline::moveTo(const Vector2& point) {
+    _start = _cursor = point;
+    _closingEdge = false;
+    _newContour = true;
+    return this;
+}
+
+Outline* Outline::lineTo(const Vector2& point) {
+    return add({EdgeType::Linear, {_cursor, point, {}, {}}});
+}
+
+Outline* Outline::quadraticTo(const Vector2& control, const Vector2& point) {
+    return add({EdgeType::Quadratic, {_cursor, control, point, {}}});
+}
+
+Outline* Outline::cubicTo(const Vector2& control1, const Vector2& control2, const Vector2& point) {
+    return add({EdgeType::Cubic, {_cursor, control1, control2, point}});
+}
+
+Outline* Outline::add(const Edge& edge) {
+    /* Contour is created on first edge so there are no empty ones */
+    if(_newContour) {
+        _contours.emplace_back();
+        _newContour = false;
+    }
+
+    /* Contour is kept closed after each addition, remove the closing edge
+       added previously */
+    Contour& contour = _contours.back();
+    if(_closingEdge) contour.pop_back();
+
+    contour.push_back(edge);
+    _cursor = edge.end();
+    if((_closingEdge = (_cursor != _start)))
+        contour.push_back({EdgeType::Linear, {_cursor, _start, {}, {}}});
+
+    return this;
+}
+
+}}
@@ -0,0 +1,151 @@
+#ifndef Magnum_TextureTools_Outline_h
+#define Magnum_TextureTools_Outline_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::TextureTools::Outline
+ */
+
+#include <vector>
+
+#include "Math/Geometry/Rectangle.h"
+#include "Magnum.h"
+
+#include "magnumTextureToolsVisibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Vector outline
+
+Closed contours composed of line segments and quadratic and cubic Bézier
+curves, such as font glyph outlines. The interface mirrors common outline
+decomposition APIs (e.g. FreeType's `FT_Outline_Decompose()`):
+@code
+TextureTools::Outline outline;
+outline.moveTo({0.0f, 0.0f})
+    ->lineTo({10.0f, 0.0f})
+    ->quadraticTo({10.0f, 10.0f}, {0.0f, 10.0f});
+@endcode
+
+Each contour is implicitly closed with line segment, if it doesn't end in the
+point where it started. Calling moveTo() at the beginning is optional, the
+first contour then starts at origin.
+@see multiChannelDistanceField()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT Outline {
+    public:
+        /** @brief Edge type */
+        enum class EdgeType: UnsignedByte {
+            Linear,     /**< Line segment */
+            Quadratic,  /**< Quadratic Bézier curve */
+            Cubic       /**< Cubic Bézier curve */
+        };
+
+        /** @brief Edge */
+        struct Edge {
+            /** @brief Edge type */
+            EdgeType type;
+
+            /**
+             * @brief Control points
+             *
+             * First point is start of the edge, last used point (second for
+             * line segment, third for quadratic curve, fourth for cubic
+             * curve) is end of the edge.
+             */
+            Vector2 points[4];
+
+            /** @brief Point at given position on the edge */
+            Vector2 point(Float t) const;
+
+            /** @brief Direction (derivative) at given position on the edge */
+            Vector2 direction(Float t) const;
+
+            /** @brief End point */
+            inline Vector2 end() const { return points[UnsignedByte(type) + 1]; }
+        };
+
+        /** @brief Contour */
+        typedef std::vector<Edge> Contour;
+
+        /** @brief Constructor */
+        explicit Outline();
+
+        /** @brief Whether the outline is empty */
+        inline bool isEmpty() const { return _contours.empty(); }
+
+        /**
+         * @brief Contours
+         *
+         * All contours are closed.
+         */
+        inline const std::vector<Contour>& contours() const { return _contours; }
+
+        /**
+         * @brief Bounds
+         *
+         * Bounding rectangle of all control points, which contains whole
+         * outline.
+         */
+        Rectangle bounds() const;
+
+        /**
+         * @brief Begin new contour
+         * @return Pointer to self (for method chaining)
+         *
+         * Closes previous contour, if any.
+         */
+        Outline* moveTo(const Vector2& point);
+
+        /**
+         * @brief Add line segment
+         * @return Pointer to self (for method chaining)
+         */
+        Outline* lineTo(const Vector2& point);
+
+        /**
+         * @brief Add quadratic Bézier curve
+         * @return Pointer to self (for method chaining)
+         */
+        Outline* quadraticTo(const Vector2& control, const Vector2& point);
+
+        /**
+         * @brief Add cubic Bézier curve
+         * @return Pointer to self (for method chaining)
+         */
+        Outline* cubicTo(const Vector2& control1, const Vector2& control2, const Vector2& point);
+
+    private:
+        Outline* add(const Edge& edge);
+
+        Vector2 _start, _cursor;
+        bool _closingEdge, _newContour;
+        std::vector<Contour> _contours;
+};
+
+}}
+
+#endif
@@ -0,0 +1,308 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelFormat.h"
+
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define MAGNUM_PIXELFORMAT_USE_SSSE3
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+typedef AbstractImage::Format Format;
+typedef AbstractImage::Type Type;
+
+/* Channel count of normalized color formats, zero for others */
+UnsignedInt channelCount(const Format format) {
+    switch(format) {
+        case Format::Red:
+        #ifndef MAGNUM_TARGET_GLES
+        case Format::Green:
+        case Format::Blue:
+        #endif
+            return 1;
+        case Format::RG:
+            return 2;
+        case Format::RGB:
+        #ifndef MAGNUM_TARGET_GLES
+        case Format::BGR:
+        #endif
+            return 3;
+        case Format::RGBA:
+        #ifndef MAGNUM_TARGET_GLES3
+        case Format::BGRA:
+        #endif
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+bool isAddingAlpha(const Format inputFormat, const Format outputFormat) {
+    #ifndef MAGNUM_TARGET_GLES
+    if(inputFormat == Format::BGR && outputFormat == Format::BGRA) return true;
+    #endif
+    return inputFormat == Format::RGB && outputFormat == Format::RGBA;
+}
+
+bool isSwappingRedBlue(const Format inputFormat, const Format outputFormat) {
+    #ifndef MAGNUM_TARGET_GLES3
+    return (inputFormat == Format::BGRA && outputFormat == Format::RGBA) ||
+           (inputFormat == Format::RGBA && outputFormat == Format::BGRA);
+    #else
+    static_cast<void>(inputFormat);
+    static_cast<void>(outputFormat);
+    return false;
+    #endif
+}
+
+#ifdef MAGNUM_PIXELFORMAT_USE_SSSE3
+/* Four pixels at once, spreading the twelve bytes to 32-bit lanes and
+   filling the alpha. The load reads four bytes past the last pixel, thus the
+   loop stops two pixels earlier to stay inside the input. Compiled for SSSE3
+   regardless of compiler flags, returns count of processed pixels. */
+__attribute__((target("ssse3"))) std::size_t addAlphaSsse3(const UnsignedByte* const input, UnsignedByte* const output, const std::size_t count) {
+    const __m128i spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(0xff000000);
+    std::size_t i = 0;
+    for(; i + 6 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i*4), _mm_or_si128(_mm_shuffle_epi8(pixels, spread), alpha));
+    }
+    return i;
+}
+
+/* Checked only once, the initialization is thread-safe */
+bool isSsse3Supported() {
+    #ifdef __SSSE3__
+    return true;
+    #else
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+    #endif
+}
+#endif
+
+/* Output is larger than input, thus it's never done in place */
+void addAlpha(const UnsignedByte* const input, UnsignedByte* const output, const std::size_t count) {
+    std::size_t i = 0;
+
+    #ifdef MAGNUM_PIXELFORMAT_USE_SSSE3
+    if(isSsse3Supported()) i = addAlphaSsse3(input, output, count);
+    #endif
+
+    for(; i != count; ++i) {
+        output[i*4 + 0] = input[i*3 + 0];
+        output[i*4 + 1] = input[i*3 + 1];
+        output[i*4 + 2] = input[i*3 + 2];
+        output[i*4 + 3] = 0xff;
+    }
+}
+
+void swapRedBlue(const UnsignedByte* const input, UnsignedByte* const output, const std::size_t count) {
+    std::size_t i = 0;
+
+    /* Four pixels at once, swapping lowest and third byte of each 32-bit
+       lane (x86 is little endian) */
+    #ifdef __SSE2__
+    const __m128i greenAlpha = _mm_set1_epi32(0xff00ff00);
+    const __m128i lowest = _mm_set1_epi32(0x000000ff);
+    for(; i + 4 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i*4));
+        const __m128i swapped = _mm_or_si128(_mm_and_si128(pixels, greenAlpha),
+            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(pixels, 16), lowest),
+                         _mm_slli_epi32(_mm_and_si128(pixels, lowest), 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i*4), swapped);
+    }
+    #endif
+
+    for(; i != count; ++i) {
+        const UnsignedByte red = input[i*4 + 0];
+        output[i*4 + 0] = input[i*4 + 2];
+        output[i*4 + 1] = input[i*4 + 1];
+        output[i*4 + 2] = red;
+        output[i*4 + 3] = input[i*4 + 3];
+    }
+}
+
+/* Equivalent to round(value/257.0), the saturation in SSE2 variant doesn't
+   change the result for values near 65535 */
+inline UnsignedByte unsignedShortToByte(const UnsignedInt value) {
+    const UnsignedInt rounded = value + 128;
+    return (rounded - (rounded >> 8)) >> 8;
+}
+
+void unsignedShortToByte(const UnsignedShort* const input, UnsignedByte* const output, const std::size_t count) {
+    std::size_t i = 0;
+
+    /* Sixteen components at once. All input is loaded before storing the
+       output, so it works also in place. */
+    #ifdef __SSE2__
+    const __m128i half = _mm_set1_epi16(128);
+    for(; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_adds_epu16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), half);
+        const __m128i b = _mm_adds_epu16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8)), half);
+        const __m128i ra = _mm_srli_epi16(_mm_sub_epi16(a, _mm_srli_epi16(a, 8)), 8);
+        const __m128i rb = _mm_srli_epi16(_mm_sub_epi16(b, _mm_srli_epi16(b, 8)), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(ra, rb));
+    }
+    #endif
+
+    for(; i != count; ++i) output[i] = unsignedShortToByte(input[i]);
+}
+
+/* Round to nearest even, overflow to infinity, NaN is preserved. Based on:
+   Fabian Giesen - Half to float done quick,
+   https://gist.github.com/rygorous/2156668 */
+UnsignedShort floatToHalf(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    const UnsignedShort sign = (bits >> 16) & 0x8000;
+    bits &= 0x7fffffff;
+
+    UnsignedShort half;
+
+    /* Infinity or NaN */
+    if(bits >= 0x7f800000)
+        half = bits > 0x7f800000 ? 0x7e00 : 0x7c00;
+
+    /* Too large, overflows to infinity */
+    else if(bits >= 0x477ff000)
+        half = 0x7c00;
+
+    /* Denormal or zero, let the FPU do the rounding by adding magic value
+       which shifts the mantissa to the right place */
+    else if(bits < 0x38800000) {
+        const UnsignedInt magicBits = 126 << 23;
+        Float magic, shifted;
+        std::memcpy(&magic, &magicBits, 4);
+        std::memcpy(&shifted, &bits, 4);
+        shifted += magic;
+        std::memcpy(&bits, &shifted, 4);
+        half = bits - magicBits;
+
+    /* Normalized, rebias exponent and round mantissa */
+    } else {
+        const UnsignedInt odd = (bits >> 13) & 1;
+        bits -= (127 - 15) << 23;
+        bits += 0xfff + odd;
+        half = bits >> 13;
+    }
+
+    return half|sign;
+}
+
+Float halfToFloat(const UnsignedShort half) {
+    const UnsignedInt shiftedExponent = 0x7c00 << 13;
+    UnsignedInt bits = (half & 0x7fff) << 13;
+    const UnsignedInt exponent = bits & shiftedExponent;
+    bits += (127 - 15) << 23;
+
+    /* Infinity or NaN */
+    if(exponent == shiftedExponent)
+        bits += (128 - 16) << 23;
+
+    /* Denormal or zero, renormalize */
+    else if(exponent == 0) {
+        const UnsignedInt magicBits = 113 << 23;
+        Float magic, value;
+        bits += 1 << 23;
+        std::memcpy(&magic, &magicBits, 4);
+        std::memcpy(&value, &bits, 4);
+        value -= magic;
+        std::memcpy(&bits, &value, 4);
+    }
+
+    bits |= UnsignedInt(half & 0x8000) << 16;
+
+    Float value;
+    std::memcpy(&value, &bits, 4);
+    return value;
+}
+
+void floatToHalf(const Float* const input, UnsignedShort* const output, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) output[i] = floatToHalf(input[i]);
+}
+
+/* Output is larger than input, thus it's never done in place */
+void halfToFloat(const UnsignedShort* const input, Float* const output, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) output[i] = halfToFloat(input[i]);
+}
+
+}
+
+bool isPixelConversionSupported(const AbstractImage::Format inputFormat, const AbstractImage::Type inputType, const AbstractImage::Format outputFormat, const AbstractImage::Type outputType) {
+    /* Plain copy */
+    if(inputFormat == outputFormat && inputType == outputType)
+        return true;
+
+    /* Swizzling */
+    if(inputType == Type::UnsignedByte && outputType == Type::UnsignedByte)
+        return isAddingAlpha(inputFormat, outputFormat) || isSwappingRedBlue(inputFormat, outputFormat);
+
+    /* Type conversion */
+    if(inputFormat != outputFormat || !channelCount(inputFormat)) return false;
+    return (inputType == Type::Float && outputType == Type::HalfFloat) ||
+           (inputType == Type::HalfFloat && outputType == Type::Float) ||
+           (inputType == Type::UnsignedShort && outputType == Type::UnsignedByte);
+}
+
+bool convertPixels(const AbstractImage::Format inputFormat, const AbstractImage::Type inputType, const void* const input, const AbstractImage::Format outputFormat, const AbstractImage::Type outputType, void* const output, const std::size_t count) {
+    if(!isPixelConversionSupported(inputFormat, inputType, outputFormat, outputType)) {
+        Error() << "TextureTools::convertPixels(): conversion from" << inputFormat << inputType << "to" << outputFormat << outputType << "is not supported";
+        return false;
+    }
+
+    /* Plain copy */
+    if(inputFormat == outputFormat && inputType == outputType) {
+        if(input != output)
+            std::memmove(output, input, AbstractImage::pixelSize(inputFormat, inputType)*count);
+
+    /* Swizzling */
+    } else if(isAddingAlpha(inputFormat, outputFormat))
+        addAlpha(static_cast<const UnsignedByte*>(input), static_cast<UnsignedByte*>(output), count);
+    else if(isSwappingRedBlue(inputFormat, outputFormat))
+        swapRedBlue(static_cast<const UnsignedByte*>(input), static_cast<UnsignedByte*>(output), count);
+
+    /* Type conversion, operating on components */
+    else {
+        const std::size_t componentCount = channelCount(inputFormat)*count;
+        if(inputType == Type::Float)
+            floatToHalf(static_cast<const Float*>(input), static_cast<UnsignedShort*>(output), componentCount);
+        else if(inputType == Type::HalfFloat)
+            halfToFloat(static_cast<const UnsignedShort*>(input), static_cast<Float*>(output), componentCount);
+        else unsignedShortToByte(static_cast<const UnsignedShort*>(input), static_cast<UnsignedByte*>(output), componentCount);
+    }
+
+    return true;
+}
+
+}}
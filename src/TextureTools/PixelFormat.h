@@ -0,0 +1,125 @@
+#ifndef Magnum_TextureTools_PixelFormat_h
+#define Magnum_TextureTools_PixelFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function Magnum::TextureTools::convertPixels(), Magnum::TextureTools::isPixelConversionSupported(), Magnum::TextureTools::convertImage()
+ */
+
+#include <Utility/Assert.h>
+
+#include "Image.h"
+
+#include "magnumTextureToolsVisibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Whether given pixel format conversion is supported
+
+Supported conversions are:
+
+-   any format and type to the same format and type (plain copy)
+-   @ref AbstractImage::Format "Format::RGB" to @ref AbstractImage::Format "Format::RGBA"
+    and @ref AbstractImage::Format "Format::BGR" to @ref AbstractImage::Format "Format::BGRA"
+    with @ref AbstractImage::Type "Type::UnsignedByte", alpha channel is
+    set to fully opaque
+-   @ref AbstractImage::Format "Format::BGRA" to @ref AbstractImage::Format "Format::RGBA"
+    and back with @ref AbstractImage::Type "Type::UnsignedByte"
+-   @ref AbstractImage::Type "Type::Float" to @ref AbstractImage::Type "Type::HalfFloat"
+    and back for any color format, the format must stay the same
+-   @ref AbstractImage::Type "Type::UnsignedShort" to @ref AbstractImage::Type "Type::UnsignedByte"
+    for any normalized color format, the format must stay the same
+
+@see convertPixels(), convertImage()
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT isPixelConversionSupported(AbstractImage::Format inputFormat, AbstractImage::Type inputType, AbstractImage::Format outputFormat, AbstractImage::Type outputType);
+
+/**
+@brief Convert pixel data to different format
+@param inputFormat  Input pixel format
+@param inputType    Input pixel type
+@param input        Input data
+@param outputFormat Output pixel format
+@param outputType   Output pixel type
+@param output       Output data
+@param count        Pixel count
+
+Converts @p count tightly packed pixels from @p input to @p output, which must
+be large enough. Returns `false` if the conversion is not supported, see
+isPixelConversionSupported() for list of supported conversions.
+
+The conversion can be done in place (i.e. @p input and @p output being the
+same pointer) if output pixel is not larger than input pixel. Swizzling and
+16-bit to 8-bit conversion is done with SSE2 instructions, if enabled at
+compile time. When compiled with GCC or Clang for x86, adding alpha channel
+uses SSSE3 instructions if the CPU supports them, regardless of compiler
+flags.
+@see convertImage()
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT convertPixels(AbstractImage::Format inputFormat, AbstractImage::Type inputType, const void* input, AbstractImage::Format outputFormat, AbstractImage::Type outputType, void* output, std::size_t count);
+
+/**
+@brief Convert image to different format
+@param input        Input image
+@param output       Output image
+
+Converts @p input to format and type of @p output. Works with Image,
+ImageWrapper and Trade::ImageData. The output image must have the same size as
+the input and already allocated data. Returns `false` if the conversion is not
+supported. See convertPixels() for more information.
+*/
+template<class Input, class Output> bool convertImage(const Input* input, Output* output) {
+    CORRADE_ASSERT(input->size() == output->size(),
+        "TextureTools::convertImage(): input and output images have different size", false);
+    return convertPixels(input->format(), input->type(), input->data(), output->format(), output->type(), output->data(), input->size().product());
+}
+
+/**
+@brief Convert image to different format in place
+@param image        %Image
+@param format       New format of pixel data
+@param type         New data type of pixel data
+
+If new pixel size is not larger than current, the data are converted in place,
+otherwise new data are allocated. Returns `false` and leaves the image
+untouched if the conversion is not supported. See convertPixels() for more
+information.
+*/
+template<UnsignedInt dimensions> bool convertImage(Image<dimensions>* image, AbstractImage::Format format, AbstractImage::Type type) {
+    if(!isPixelConversionSupported(image->format(), image->type(), format, type))
+        return false;
+
+    const std::size_t count = image->size().product();
+    unsigned char* data = AbstractImage::pixelSize(format, type) <= AbstractImage::pixelSize(image->format(), image->type()) ?
+        image->data() : new unsigned char[AbstractImage::pixelSize(format, type)*count];
+    convertPixels(image->format(), image->type(), image->data(), format, type, data, count);
+    image->setData(image->size(), format, type, data);
+    return true;
+}
+
+}}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelFormatConverter.h"
+
+#include "Image.h"
+#include "TextureTools/PixelFormat.h"
+
+namespace Magnum { namespace TextureTools {
+
+PixelFormatConverter::PixelFormatConverter(const AbstractImage::Format format, const AbstractImage::Type type): _format(format), _type(type) {}
+
+auto PixelFormatConverter::features() const -> Features {
+    return Feature::ConvertToImage;
+}
+
+Image2D* PixelFormatConverter::convertToImage(const Image2D* const image) const {
+    const std::size_t count = image->size().product();
+    unsigned char* const data = new unsigned char[AbstractImage::pixelSize(_format, _type)*count];
+    if(!convertPixels(image->format(), image->type(), image->data(), _format, _type, data, count)) {
+        delete[] data;
+        return nullptr;
+    }
+
+    return new Image2D(image->size(), _format, _type, data);
+}
+
+}}
@@ -0,0 +1,83 @@
+#ifndef Magnum_TextureTools_PixelFormatConverter_h
+#define Magnum_TextureTools_PixelFormatConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::TextureTools::PixelFormatConverter
+ */
+
+#include "AbstractImage.h"
+#include "Trade/AbstractImageConverter.h"
+
+#include "magnumTextureToolsVisibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Pixel format converter
+
+Image converter using convertPixels() for converting images to given format
+and type, usable anywhere where Trade::AbstractImageConverter is expected:
+@code
+TextureTools::PixelFormatConverter converter(AbstractImage::Format::RGBA, AbstractImage::Type::UnsignedByte);
+Image2D* converted = converter.convertToImage(image);
+@endcode
+
+Supports only @ref Trade::AbstractImageConverter::Feature "Feature::ConvertToImage".
+See isPixelConversionSupported() for list of supported conversions.
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT PixelFormatConverter: public Trade::AbstractImageConverter {
+    public:
+        /**
+         * @brief Constructor
+         * @param format        Format of converted images
+         * @param type          Data type of converted images
+         */
+        explicit PixelFormatConverter(AbstractImage::Format format, AbstractImage::Type type);
+
+        /** @brief Format of converted images */
+        inline AbstractImage::Format format() const { return _format; }
+
+        /** @brief Data type of converted images */
+        inline AbstractImage::Type type() const { return _type; }
+
+        Features features() const override;
+
+        /**
+         * @brief Convert image to different format
+         *
+         * Returns new image with format() and type() or `nullptr` if the
+         * conversion is not supported.
+         */
+        Image2D* convertToImage(const Image2D* image) const override;
+
+    private:
+        AbstractImage::Format _format;
+        AbstractImage::Type _type;
+};
+
+}}
+
+#endif
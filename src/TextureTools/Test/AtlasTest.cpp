@@ -38,13 +38,27 @@ class AtlasTest: public Corrade::TestSuite::Tester {
         void createPadding();
         void createEmpty();
         void createTooSmall();
+        void createRotation();
+        void createOccupancy();
+        void createMany();
+
+        void packerIncremental();
+        void packerFull();
+        void packerRemove();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+              &AtlasTest::createRotation,
+              &AtlasTest::createOccupancy,
+              &AtlasTest::createMany,
+
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerFull,
+              &AtlasTest::packerRemove});
 }
 
 void AtlasTest::create() {
@@ -56,9 +70,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
-        Rectanglei::fromSize({0, 0}, {12, 18}),
-        Rectanglei::fromSize({32, 0}, {32, 15}),
-        Rectanglei::fromSize({0, 25}, {23, 25})}));
+        Rectanglei::fromSize({23, 0}, {12, 18}),
+        Rectanglei::fromSize({23, 18}, {32, 15}),
+        Rectanglei::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +84,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
-        Rectanglei::fromSize({2, 1}, {8, 16}),
-        Rectanglei::fromSize({34, 1}, {28, 13}),
-        Rectanglei::fromSize({2, 26}, {19, 23})}));
+        Rectanglei::fromSize({25, 1}, {8, 16}),
+        Rectanglei::fromSize({25, 19}, {28, 13}),
+        Rectanglei::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -84,13 +98,118 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error::setOutput(&o);
 
-    std::vector<Rectanglei> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Rectanglei> atlas = TextureTools::atlas({48, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(48, 32) is too small to fit 3 textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::createRotation() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    /* Second texture fits only if rotated */
+    std::vector<Rectanglei> atlas = TextureTools::atlas({24, 16}, {
+        {16, 16},
+        {16, 8}
+    });
+    CORRADE_VERIFY(atlas.empty());
+
+    atlas = TextureTools::atlas({24, 16}, {
+        {16, 16},
+        {16, 8}
+    }, {}, AtlasFlag::AllowRotation);
+    CORRADE_COMPARE(atlas, (std::vector<Rectanglei>{
+        Rectanglei::fromSize({0, 0}, {16, 16}),
+        Rectanglei::fromSize({16, 0}, {8, 16})}));
+}
+
+void AtlasTest::createOccupancy() {
+    Float occupancy;
+    std::vector<Rectanglei> atlas = TextureTools::atlas({32, 32}, {
+        {16, 16},
+        {8, 8},
+        {14, 6}
+    }, {1, 1}, {}, &occupancy);
+    CORRADE_COMPARE(atlas.size(), 3);
+    CORRADE_COMPARE(occupancy, (18*18 + 10*10 + 16*8)/1024.0f);
+}
+
+void AtlasTest::createMany() {
+    /* Pseudo-random sizes of widely varying sizes */
+    std::vector<Vector2i> sizes;
+    for(Int i = 0; i != 5000; ++i)
+        sizes.push_back({1 + (i*7919)%23, 1 + (i*104729)%17});
+
+    Float occupancy;
+    std::vector<Rectanglei> atlas = TextureTools::atlas({960, 896}, sizes, {1, 1}, AtlasFlag::AllowRotation, &occupancy);
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+
+    /* Everything is inside, nothing overlaps, with padding */
+    std::vector<UnsignedByte> used(960*896);
+    for(std::size_t i = 0; i != atlas.size(); ++i) {
+        CORRADE_VERIFY(atlas[i].size() == sizes[i] || atlas[i].size() == Vector2i(sizes[i].y(), sizes[i].x()));
+        CORRADE_VERIFY(atlas[i].left() >= 1 && atlas[i].bottom() >= 1);
+        CORRADE_VERIFY(atlas[i].right() <= 959 && atlas[i].top() <= 895);
+        for(Int y = atlas[i].bottom()-1; y != atlas[i].top()+1; ++y)
+            for(Int x = atlas[i].left()-1; x != atlas[i].right()+1; ++x)
+                CORRADE_VERIFY(!used[y*960 + x]++);
+    }
+
+    /* Uniform grid with 25x19 cells would fit only 1786 of them */
+    CORRADE_VERIFY(occupancy > 0.89f);
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer({64, 64}, {1, 1});
+    CORRADE_COMPARE(packer.add({{23, 25}}), (std::vector<Rectanglei>{
+        Rectanglei::fromSize({1, 1}, {23, 25})}));
+    CORRADE_COMPARE(packer.add({{12, 18}, {30, 8}}), (std::vector<Rectanglei>{
+        Rectanglei::fromSize({26, 1}, {12, 18}),
+        Rectanglei::fromSize({26, 21}, {30, 8})}));
+    CORRADE_COMPARE(packer.occupancy(), (25*27 + 14*20 + 32*10)/4096.0f);
+}
+
+void AtlasTest::packerFull() {
+    AtlasPacker packer({32, 32});
+    CORRADE_COMPARE(packer.add({{32, 16}}).size(), 1);
+
+    /* Second one doesn't fit, nothing is added */
+    CORRADE_VERIFY(packer.add({{16, 16}, {32, 1}}).empty());
+    CORRADE_COMPARE(packer.occupancy(), 0.5f);
+
+    CORRADE_COMPARE(packer.add({{16, 16}, {16, 16}}), (std::vector<Rectanglei>{
+        Rectanglei::fromSize({0, 16}, {16, 16}),
+        Rectanglei::fromSize({16, 16}, {16, 16})}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+
+    packer.clear();
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+    CORRADE_COMPARE(packer.add({{32, 32}}).size(), 1);
+}
+
+void AtlasTest::packerRemove() {
+    AtlasPacker packer({32, 32}, {1, 1});
+    std::vector<Rectanglei> rectangles = packer.add({{14, 14}, {14, 14}, {14, 14}, {14, 14}});
+    CORRADE_COMPARE(rectangles.size(), 4);
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+
+    /* Full, removing one makes space for smaller textures */
+    CORRADE_VERIFY(packer.add({{6, 6}}).empty());
+    packer.remove(rectangles[2]);
+    CORRADE_COMPARE(packer.occupancy(), 0.75f);
+
+    const Vector2i origin = rectangles[2].bottomLeft() - Vector2i(1);
+    CORRADE_COMPARE(packer.add({{6, 6}, {6, 6}, {6, 6}, {6, 6}}), (std::vector<Rectanglei>{
+        Rectanglei::fromSize(origin + Vector2i(1, 1), {6, 6}),
+        Rectanglei::fromSize(origin + Vector2i(9, 1), {6, 6}),
+        Rectanglei::fromSize(origin + Vector2i(1, 9), {6, 6}),
+        Rectanglei::fromSize(origin + Vector2i(9, 9), {6, 6})}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+    CORRADE_VERIFY(packer.add({{1, 1}}).empty());
 }
 
 }}}
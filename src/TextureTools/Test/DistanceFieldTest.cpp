@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <TestSuite/Tester.h>
+
+#include "Math/Functions.h"
+#include "Math/Geometry/Rectangle.h"
+#include "Image.h"
+#include "TextureTools/DistanceField.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class DistanceFieldTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit DistanceFieldTest();
+
+        void cpu();
+        void cpuRectangle();
+        void cpuScaled();
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::cpu,
+              &DistanceFieldTest::cpuRectangle,
+              &DistanceFieldTest::cpuScaled});
+}
+
+namespace {
+    /* Pseudo-random blobs */
+    Image2D* input(const Vector2i& size) {
+        UnsignedByte* data = new UnsignedByte[size.product()];
+        for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x)
+            data[y*size.x() + x] = ((x/5*7 + y/3*13 + (x*y)%7) % 5 < 2) ? 255 : 0;
+        return new Image2D(size, Image2D::Format::Red, Image2D::Type::UnsignedByte, data);
+    }
+
+    /* Brute-force search of the surroundings, same as the shader does */
+    UnsignedByte reference(const Image2D* image, const Vector2i& position, Int radius) {
+        auto isSet = [image](const Vector2i& position) {
+            if(position.x() < 0 || position.y() < 0 || position.x() >= image->size().x() || position.y() >= image->size().y())
+                return false;
+            return image->data()[position.y()*image->size().x() + position.x()] > 127;
+        };
+
+        const bool isInside = isSet(position);
+        Float minDistanceSquared = Float((radius + 1)*(radius + 1));
+        for(Int y = -radius; y <= radius; ++y) for(Int x = -radius; x <= radius; ++x)
+            if(isSet(position + Vector2i(x, y)) != isInside)
+                minDistanceSquared = std::min(minDistanceSquared, Float(x*x + y*y));
+
+        const Float value = (isInside ? 1.0f : -1.0f)*std::sqrt(minDistanceSquared)/Float(radius*2 + 2) + 0.5f;
+        return UnsignedByte(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+    }
+}
+
+void DistanceFieldTest::cpu() {
+    /* 4x4 square in the middle */
+    Image2D in({8, 8}, Image2D::Format::Red, Image2D::Type::UnsignedByte, new UnsignedByte[8*8]{});
+    for(Int y = 2; y != 6; ++y) for(Int x = 2; x != 6; ++x)
+        in.data()[y*8 + x] = 255;
+    Image2D out({8, 8}, Image2D::Format::Red, Image2D::Type::UnsignedByte, new UnsignedByte[64]);
+
+    distanceField(&in, &out, Rectanglei::fromSize({}, {8, 8}), 2);
+
+    /* Edge pixel inside, one pixel from outside */
+    CORRADE_COMPARE(Int(out.data()[2*8 + 2]), 170);
+    /* Center, two pixels from outside */
+    CORRADE_COMPARE(Int(out.data()[3*8 + 3]), 213);
+    /* Next to the edge outside */
+    CORRADE_COMPARE(Int(out.data()[1*8 + 3]), 85);
+    /* Corner, sqrt(8) from the square */
+    CORRADE_COMPARE(Int(out.data()[0]), 7);
+}
+
+void DistanceFieldTest::cpuRectangle() {
+    Image2D* in = input({64, 48});
+    Image2D out({80, 64}, Image2D::Format::Red, Image2D::Type::UnsignedByte, new UnsignedByte[80*64]);
+    std::fill_n(out.data(), 80*64, 42);
+
+    const Rectanglei rectangle = Rectanglei::fromSize({10, 12}, {64, 48});
+    distanceField(in, &out, rectangle, 4);
+
+    for(Int y = 0; y != 64; ++y) for(Int x = 0; x != 80; ++x) {
+        const UnsignedByte value = out.data()[y*80 + x];
+        if(x < rectangle.left() || x >= rectangle.right() || y < rectangle.bottom() || y >= rectangle.top())
+            CORRADE_COMPARE(Int(value), 42);
+        else
+            CORRADE_COMPARE(Int(value), Int(reference(in, Vector2i(x, y) - rectangle.bottomLeft(), 4)));
+    }
+
+    delete in;
+}
+
+void DistanceFieldTest::cpuScaled() {
+    /* Large enough to be processed on more threads */
+    Image2D* in = input({1024, 768});
+    Image2D out({256, 192}, Image2D::Format::Red, Image2D::Type::UnsignedByte, new UnsignedByte[256*192]);
+
+    distanceField(in, &out, Rectanglei::fromSize({}, {256, 192}), 12);
+
+    for(Int y = 0; y != 192; ++y) for(Int x = 0; x != 256; ++x)
+        CORRADE_COMPARE(Int(out.data()[y*256 + x]), Int(reference(in, Vector2i(x, y)*4, 12)));
+
+    delete in;
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
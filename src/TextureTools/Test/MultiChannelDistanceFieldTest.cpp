@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <TestSuite/Tester.h>
+
+#include "Math/Geometry/Rectangle.h"
+#include "Image.h"
+#include "TextureTools/MultiChannelDistanceField.h"
+#include "TextureTools/Outline.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class MultiChannelDistanceFieldTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit MultiChannelDistanceFieldTest();
+
+        void outline();
+        void outlineClosed();
+        void square();
+        void orientation();
+        void corner();
+        void curves();
+};
+
+MultiChannelDistanceFieldTest::MultiChannelDistanceFieldTest() {
+    addTests({&MultiChannelDistanceFieldTest::outline,
+              &MultiChannelDistanceFieldTest::outlineClosed,
+              &MultiChannelDistanceFieldTest::square,
+              &MultiChannelDistanceFieldTest::orientation,
+              &MultiChannelDistanceFieldTest::corner,
+              &MultiChannelDistanceFieldTest::curves});
+}
+
+namespace {
+    Image2D* field(const Outline& outline) {
+        Image2D* image = new Image2D({8, 8}, Image2D::Format::RGBA, Image2D::Type::UnsignedByte, new UnsignedByte[8*8*4]{});
+        multiChannelDistanceField(outline, {{}, {8.0f, 8.0f}}, image, {{}, {8, 8}}, 4.0f);
+        return image;
+    }
+
+    inline const UnsignedByte* pixel(const Image2D* image, const Vector2i& position) {
+        return image->data() + (position.y()*image->size().x() + position.x())*4;
+    }
+
+    inline UnsignedByte median(const UnsignedByte* pixel) {
+        return std::max(std::min(pixel[0], pixel[1]), std::min(std::max(pixel[0], pixel[1]), pixel[2]));
+    }
+}
+
+void MultiChannelDistanceFieldTest::outline() {
+    Outline outline;
+    CORRADE_VERIFY(outline.isEmpty());
+
+    outline.moveTo({1.0f, 1.0f})
+        ->lineTo({3.0f, 1.0f})
+        ->quadraticTo({3.0f, 3.0f}, {1.0f, 3.0f})
+        ->moveTo({5.0f, 5.0f})
+        ->cubicTo({6.0f, 4.0f}, {7.0f, 6.0f}, {5.0f, 7.0f});
+    CORRADE_VERIFY(!outline.isEmpty());
+    CORRADE_COMPARE(outline.contours().size(), 2);
+
+    /* Both contours are implicitly closed */
+    const Outline::Contour& first = outline.contours()[0];
+    CORRADE_COMPARE(first.size(), 3);
+    CORRADE_VERIFY(first[1].type == Outline::EdgeType::Quadratic);
+    CORRADE_VERIFY(first[2].type == Outline::EdgeType::Linear);
+    CORRADE_COMPARE(first[2].points[0], Vector2(1.0f, 3.0f));
+    CORRADE_COMPARE(first[2].end(), Vector2(1.0f, 1.0f));
+
+    const Outline::Contour& second = outline.contours()[1];
+    CORRADE_COMPARE(second.size(), 2);
+    CORRADE_VERIFY(second[0].type == Outline::EdgeType::Cubic);
+    CORRADE_COMPARE(second[0].end(), Vector2(5.0f, 7.0f));
+    CORRADE_COMPARE(second[1].end(), Vector2(5.0f, 5.0f));
+
+    CORRADE_COMPARE(outline.bounds(), Rectangle({1.0f, 1.0f}, {7.0f, 7.0f}));
+}
+
+void MultiChannelDistanceFieldTest::outlineClosed() {
+    /* Explicitly closed contour doesn't get any additional edge */
+    Outline outline;
+    outline.moveTo({1.0f, 1.0f})
+        ->lineTo({3.0f, 1.0f})
+        ->lineTo({3.0f, 3.0f})
+        ->lineTo({1.0f, 1.0f});
+    CORRADE_COMPARE(outline.contours().size(), 1);
+    CORRADE_COMPARE(outline.contours()[0].size(), 3);
+}
+
+void MultiChannelDistanceFieldTest::square() {
+    /* 4x4 square in the middle */
+    Outline outline;
+    outline.moveTo({2.0f, 2.0f})
+        ->lineTo({6.0f, 2.0f})
+        ->lineTo({6.0f, 6.0f})
+        ->lineTo({2.0f, 6.0f});
+    Image2D* image = field(outline);
+
+    /* Inside, 1.5 units from the edges */
+    CORRADE_COMPARE(Int(pixel(image, {3, 3})[3]), 175);
+    CORRADE_VERIFY(median(pixel(image, {3, 3})) > 127);
+
+    /* Outside, 2.12 units from the corner */
+    CORRADE_COMPARE(Int(pixel(image, {0, 0})[3]), 60);
+    CORRADE_VERIFY(median(pixel(image, {0, 0})) < 128);
+
+    /* Outside, 0.5 units from the edge */
+    CORRADE_COMPARE(Int(pixel(image, {4, 6})[3]), 112);
+    CORRADE_COMPARE(Int(median(pixel(image, {4, 6}))), 112);
+
+    delete image;
+}
+
+void MultiChannelDistanceFieldTest::orientation() {
+    /* Clockwise contours give the same result */
+    Outline clockwise;
+    clockwise.moveTo({2.0f, 2.0f})
+        ->lineTo({2.0f, 6.0f})
+        ->lineTo({6.0f, 6.0f})
+        ->lineTo({6.0f, 2.0f});
+    Outline counterClockwise;
+    counterClockwise.moveTo({2.0f, 2.0f})
+        ->lineTo({6.0f, 2.0f})
+        ->lineTo({6.0f, 6.0f})
+        ->lineTo({2.0f, 6.0f});
+    Image2D* a = field(clockwise);
+    Image2D* b = field(counterClockwise);
+
+    for(Int y = 0; y != 8; ++y) for(Int x = 0; x != 8; ++x) {
+        CORRADE_COMPARE(Int(pixel(a, {x, y})[3]), Int(pixel(b, {x, y})[3]));
+        CORRADE_COMPARE(Int(median(pixel(a, {x, y}))), Int(median(pixel(b, {x, y}))));
+    }
+
+    delete a;
+    delete b;
+}
+
+void MultiChannelDistanceFieldTest::corner() {
+    Outline outline;
+    outline.moveTo({2.0f, 2.0f})
+        ->lineTo({6.0f, 2.0f})
+        ->lineTo({6.0f, 6.0f})
+        ->lineTo({2.0f, 6.0f});
+    Image2D* image = field(outline);
+
+    /* Diagonally outside the corner, the true distance is rounded (0.71
+       units), but the median preserves the sharp corner (0.5 units) */
+    CORRADE_COMPARE(Int(pixel(image, {1, 1})[3]), 105);
+    CORRADE_COMPARE(Int(median(pixel(image, {1, 1}))), 112);
+    CORRADE_COMPARE(Int(pixel(image, {6, 6})[3]), 105);
+    CORRADE_COMPARE(Int(median(pixel(image, {6, 6}))), 112);
+
+    delete image;
+}
+
+void MultiChannelDistanceFieldTest::curves() {
+    /* Curves degenerated to lines give the same result as lines */
+    Outline lines;
+    lines.moveTo({2.0f, 2.0f})
+        ->lineTo({6.0f, 2.0f})
+        ->lineTo({6.0f, 6.0f})
+        ->lineTo({2.0f, 6.0f});
+    Outline curves;
+    curves.moveTo({2.0f, 2.0f})
+        ->quadraticTo({4.0f, 2.0f}, {6.0f, 2.0f})
+        ->cubicTo({6.0f, 3.0f}, {6.0f, 5.0f}, {6.0f, 6.0f})
+        ->quadraticTo({4.0f, 6.0f}, {2.0f, 6.0f});
+    Image2D* a = field(lines);
+    Image2D* b = field(curves);
+
+    for(Int y = 0; y != 8; ++y) for(Int x = 0; x != 8; ++x) for(Int i = 0; i != 4; ++i)
+        CORRADE_VERIFY(std::abs(Int(pixel(a, {x, y})[i]) - Int(pixel(b, {x, y})[i])) <= 1);
+
+    delete a;
+    delete b;
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::MultiChannelDistanceFieldTest)
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Image.h"
+#include "ImageWrapper.h"
+#include "TextureTools/PixelFormat.h"
+#include "TextureTools/PixelFormatConverter.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class PixelFormatTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit PixelFormatTest();
+
+        void supported();
+        void copy();
+        void addAlpha();
+        void swapRedBlue();
+        void unsignedShortToByte();
+        void floatToHalf();
+        void halfToFloat();
+        void image();
+        void imageInPlace();
+        void converter();
+};
+
+PixelFormatTest::PixelFormatTest() {
+    addTests({&PixelFormatTest::supported,
+              &PixelFormatTest::copy,
+              &PixelFormatTest::addAlpha,
+              &PixelFormatTest::swapRedBlue,
+              &PixelFormatTest::unsignedShortToByte,
+              &PixelFormatTest::floatToHalf,
+              &PixelFormatTest::halfToFloat,
+              &PixelFormatTest::image,
+              &PixelFormatTest::imageInPlace,
+              &PixelFormatTest::converter});
+}
+
+typedef AbstractImage::Format Format;
+typedef AbstractImage::Type Type;
+
+namespace {
+    /* Image deletes the data as unsigned char array */
+    template<class T, std::size_t size> unsigned char* imageData(const T(&data)[size]) {
+        unsigned char* out = new unsigned char[sizeof(data)];
+        std::memcpy(out, data, sizeof(data));
+        return out;
+    }
+}
+
+void PixelFormatTest::supported() {
+    CORRADE_VERIFY(isPixelConversionSupported(Format::RGB, Type::UnsignedByte, Format::RGBA, Type::UnsignedByte));
+    CORRADE_VERIFY(isPixelConversionSupported(Format::RG, Type::Float, Format::RG, Type::HalfFloat));
+    CORRADE_VERIFY(isPixelConversionSupported(Format::Red, Type::UnsignedShort, Format::Red, Type::UnsignedByte));
+    CORRADE_VERIFY(isPixelConversionSupported(Format::DepthComponent, Type::Float, Format::DepthComponent, Type::Float));
+
+    CORRADE_VERIFY(!isPixelConversionSupported(Format::RGBA, Type::UnsignedByte, Format::RGB, Type::UnsignedByte));
+    CORRADE_VERIFY(!isPixelConversionSupported(Format::RGB, Type::Float, Format::RGBA, Type::HalfFloat));
+    CORRADE_VERIFY(!isPixelConversionSupported(Format::RGB, Type::UnsignedByte, Format::RGB, Type::UnsignedShort));
+    CORRADE_VERIFY(!isPixelConversionSupported(Format::DepthComponent, Type::Float, Format::DepthComponent, Type::HalfFloat));
+
+    UnsignedByte data[4]{};
+    std::ostringstream o;
+    Error::setOutput(&o);
+    CORRADE_VERIFY(!convertPixels(Format::RGBA, Type::UnsignedByte, data, Format::RGB, Type::UnsignedByte, data, 1));
+    CORRADE_COMPARE(o.str(), "TextureTools::convertPixels(): conversion from AbstractImage::Format::RGBA AbstractImage::Type::UnsignedByte to AbstractImage::Format::RGB AbstractImage::Type::UnsignedByte is not supported\n");
+}
+
+void PixelFormatTest::copy() {
+    const UnsignedShort input[] = {1, 2, 3, 4, 5, 6};
+    UnsignedShort output[6]{};
+    CORRADE_VERIFY(convertPixels(Format::RG, Type::UnsignedShort, input, Format::RG, Type::UnsignedShort, output, 3));
+    CORRADE_VERIFY(std::equal(input, input + 6, output));
+}
+
+void PixelFormatTest::addAlpha() {
+    const UnsignedByte input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    UnsignedByte output[12]{};
+    CORRADE_VERIFY(convertPixels(Format::RGB, Type::UnsignedByte, input, Format::RGBA, Type::UnsignedByte, output, 3));
+
+    const UnsignedByte expected[] = {1, 2, 3, 255, 4, 5, 6, 255, 7, 8, 9, 255};
+    CORRADE_VERIFY(std::equal(expected, expected + 12, output));
+
+    /* Eleven pixels to test both vectorized and remaining part */
+    UnsignedByte data[11*3];
+    for(UnsignedInt i = 0; i != 11*3; ++i) data[i] = i;
+
+    UnsignedByte rgba[11*4];
+    CORRADE_VERIFY(convertPixels(Format::RGB, Type::UnsignedByte, data, Format::RGBA, Type::UnsignedByte, rgba, 11));
+    for(UnsignedInt i = 0; i != 11; ++i) {
+        CORRADE_COMPARE(rgba[i*4 + 0], i*3 + 0);
+        CORRADE_COMPARE(rgba[i*4 + 1], i*3 + 1);
+        CORRADE_COMPARE(rgba[i*4 + 2], i*3 + 2);
+        CORRADE_COMPARE(rgba[i*4 + 3], 255);
+    }
+}
+
+void PixelFormatTest::swapRedBlue() {
+    /* Seven pixels to test both vectorized and remaining part */
+    UnsignedByte data[7*4];
+    for(UnsignedInt i = 0; i != 7*4; ++i) data[i] = i;
+
+    UnsignedByte output[7*4];
+    CORRADE_VERIFY(convertPixels(Format::BGRA, Type::UnsignedByte, data, Format::RGBA, Type::UnsignedByte, output, 7));
+    for(UnsignedInt i = 0; i != 7; ++i) {
+        CORRADE_COMPARE(output[i*4 + 0], i*4 + 2);
+        CORRADE_COMPARE(output[i*4 + 1], i*4 + 1);
+        CORRADE_COMPARE(output[i*4 + 2], i*4 + 0);
+        CORRADE_COMPARE(output[i*4 + 3], i*4 + 3);
+    }
+
+    /* In place, swapping back */
+    CORRADE_VERIFY(convertPixels(Format::RGBA, Type::UnsignedByte, output, Format::BGRA, Type::UnsignedByte, output, 7));
+    CORRADE_VERIFY(std::equal(data, data + 7*4, output));
+}
+
+void PixelFormatTest::unsignedShortToByte() {
+    /* Twenty components to test both vectorized and remaining part */
+    UnsignedShort data[20];
+    for(UnsignedInt i = 0; i != 20; ++i) data[i] = i*3449;
+    data[18] = 128;
+    data[19] = 65535;
+
+    UnsignedByte output[20];
+    CORRADE_VERIFY(convertPixels(Format::RGBA, Type::UnsignedShort, data, Format::RGBA, Type::UnsignedByte, output, 5));
+    for(UnsignedInt i = 0; i != 20; ++i)
+        CORRADE_COMPARE(output[i], UnsignedByte(std::floor(data[i]/257.0 + 0.5)));
+
+    /* In place */
+    CORRADE_VERIFY(convertPixels(Format::RGBA, Type::UnsignedShort, data, Format::RGBA, Type::UnsignedByte, data, 5));
+    CORRADE_VERIFY(std::equal(output, output + 20, reinterpret_cast<UnsignedByte*>(data)));
+}
+
+void PixelFormatTest::floatToHalf() {
+    const Float input[] = {
+        0.0f, -0.0f, 1.0f, -2.0f, 0.333333f, 65504.0f, 65520.0f,
+        6.0e-8f, 1.0e-8f, 3.0517578e-5f,
+        std::numeric_limits<Float>::infinity(),
+        std::numeric_limits<Float>::quiet_NaN()
+    };
+    UnsignedShort output[12];
+    CORRADE_VERIFY(convertPixels(Format::Red, Type::Float, input, Format::Red, Type::HalfFloat, output, 12));
+
+    CORRADE_COMPARE(output[0], 0x0000);
+    CORRADE_COMPARE(output[1], 0x8000);
+    CORRADE_COMPARE(output[2], 0x3c00);
+    CORRADE_COMPARE(output[3], 0xc000);
+    CORRADE_COMPARE(output[4], 0x3555);
+    CORRADE_COMPARE(output[5], 0x7bff);
+    CORRADE_COMPARE(output[6], 0x7c00);
+    CORRADE_COMPARE(output[7], 0x0001);
+    CORRADE_COMPARE(output[8], 0x0000);
+    CORRADE_COMPARE(output[9], 0x0200);
+    CORRADE_COMPARE(output[10], 0x7c00);
+    CORRADE_COMPARE(output[11], 0x7e00);
+}
+
+void PixelFormatTest::halfToFloat() {
+    const UnsignedShort input[] = {0x0000, 0x8000, 0x3c00, 0xc000, 0x7bff, 0x0001, 0x0200, 0x7c00, 0x7e00};
+    Float output[9];
+    CORRADE_VERIFY(convertPixels(Format::Red, Type::HalfFloat, input, Format::Red, Type::Float, output, 9));
+
+    CORRADE_COMPARE(output[0], 0.0f);
+    CORRADE_VERIFY(std::signbit(output[1]));
+    CORRADE_COMPARE(output[2], 1.0f);
+    CORRADE_COMPARE(output[3], -2.0f);
+    CORRADE_COMPARE(output[4], 65504.0f);
+    CORRADE_COMPARE(output[5], 5.9604645e-8f);
+    CORRADE_COMPARE(output[6], 3.0517578e-5f);
+    CORRADE_COMPARE(output[7], std::numeric_limits<Float>::infinity());
+    CORRADE_VERIFY(output[8] != output[8]);
+}
+
+void PixelFormatTest::image() {
+    UnsignedByte data[]{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    const ImageWrapper2D input({2, 2}, Format::RGB, Type::UnsignedByte, data);
+    Image2D output({2, 2}, Format::RGBA, Type::UnsignedByte, new UnsignedByte[16]);
+    CORRADE_VERIFY(convertImage(&input, &output));
+    CORRADE_COMPARE(output.data()[11], 255);
+    CORRADE_COMPARE(output.data()[14], 12);
+}
+
+void PixelFormatTest::imageInPlace() {
+    /* Smaller pixels, converted in place */
+    Image2D image({1, 2}, Format::RG, Type::UnsignedShort, imageData<UnsignedShort>({0, 65535, 257, 514}));
+    const unsigned char* data = image.data();
+    CORRADE_VERIFY(convertImage(&image, Format::RG, Type::UnsignedByte));
+    CORRADE_VERIFY(image.data() == data);
+    CORRADE_COMPARE(image.type(), Type::UnsignedByte);
+    CORRADE_COMPARE(image.data()[1], 255);
+    CORRADE_COMPARE(image.data()[3], 2);
+
+    /* Larger pixels, reallocated */
+    Image2D rgb({2, 1}, Format::RGB, Type::UnsignedByte, new UnsignedByte[6]{1, 2, 3, 4, 5, 6});
+    CORRADE_VERIFY(convertImage(&rgb, Format::RGBA, Type::UnsignedByte));
+    CORRADE_COMPARE(rgb.format(), Format::RGBA);
+    CORRADE_COMPARE(rgb.data()[4], 4);
+    CORRADE_COMPARE(rgb.data()[7], 255);
+
+    /* Unsupported, untouched */
+    CORRADE_VERIFY(!convertImage(&rgb, Format::RGB, Type::Float));
+    CORRADE_COMPARE(rgb.format(), Format::RGBA);
+}
+
+void PixelFormatTest::converter() {
+    PixelFormatConverter converter(Format::RG, Type::HalfFloat);
+    CORRADE_VERIFY(converter.features() == Trade::AbstractImageConverter::Feature::ConvertToImage);
+
+    const Image2D input({1, 1}, Format::RG, Type::Float, imageData<Float>({1.0f, -2.0f}));
+    Image2D* output = converter.convertToImage(&input);
+    CORRADE_VERIFY(output);
+    CORRADE_COMPARE(output->size(), Vector2i(1, 1));
+    CORRADE_COMPARE(output->type(), Type::HalfFloat);
+    CORRADE_COMPARE(reinterpret_cast<UnsignedShort*>(output->data())[0], 0x3c00);
+    CORRADE_COMPARE(reinterpret_cast<UnsignedShort*>(output->data())[1], 0xc000);
+    delete output;
+
+    std::ostringstream o;
+    Error::setOutput(&o);
+    const Image2D depth({1, 1}, Format::DepthComponent, Type::Float, imageData<Float>({0.0f}));
+    CORRADE_VERIFY(!converter.convertToImage(&depth));
+    CORRADE_COMPARE(o.str(), "TextureTools::convertPixels(): conversion from AbstractImage::Format::DepthComponent AbstractImage::Type::Float to AbstractImage::Format::RG AbstractImage::Type::HalfFloat is not supported\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::PixelFormatTest)
@@ -28,6 +28,7 @@
  * @brief Class Magnum::Trade::AbstractImageConverter
  */
 
+#include <Containers/EnumSet.h>
 #include <PluginManager/AbstractPlugin.h>
 
 #include "Magnum.h"
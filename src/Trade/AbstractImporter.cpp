@@ -24,63 +24,135 @@
 
 #include "AbstractImporter.h"
 
+#include <unordered_map>
 #include <Utility/Assert.h>
 
 namespace Magnum { namespace Trade {
 
-AbstractImporter::AbstractImporter() = default;
+namespace {
+    enum: std::size_t {
+        SceneNames, LightNames, CameraNames, Object2DNames, Object3DNames,
+        Mesh2DNames, Mesh3DNames, MaterialNames, TextureNames, Image1DNames,
+        Image2DNames, Image3DNames, NameCategoryCount
+    };
+}
+
+struct AbstractImporter::NameIndex {
+    struct Category {
+        inline Category(): built(false) {}
+
+        bool built;
+        std::unordered_map<std::string, UnsignedInt> ids;
+    } categories[NameCategoryCount];
+};
 
-AbstractImporter::AbstractImporter(Corrade::PluginManager::AbstractPluginManager* manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)) {}
+AbstractImporter::AbstractImporter(): _nameIndex(nullptr) {}
 
-bool AbstractImporter::openData(const void* const, const std::size_t) {
+AbstractImporter::AbstractImporter(Corrade::PluginManager::AbstractPluginManager* manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)), _nameIndex(nullptr) {}
+
+AbstractImporter::~AbstractImporter() { delete _nameIndex; }
+
+bool AbstractImporter::openData(const void* const data, const std::size_t size) {
+    delete _nameIndex;
+    _nameIndex = nullptr;
+    return doOpenData(data, size);
+}
+
+bool AbstractImporter::doOpenData(const void* const, const std::size_t) {
     CORRADE_ASSERT(features() & Feature::OpenData,
-        "Trade::AbstractImporter::openData(): feature advertised but not implemented", nullptr);
+        "Trade::AbstractImporter::openData(): feature advertised but not implemented", false);
+
+    CORRADE_ASSERT(false, "Trade::AbstractImporter::openData(): feature not implemented", false);
+}
 
-    CORRADE_ASSERT(false, "Trade::AbstractImporter::openData(): feature not implemented", nullptr);
+bool AbstractImporter::openFile(const std::string& filename) {
+    delete _nameIndex;
+    _nameIndex = nullptr;
+    return doOpenFile(filename);
 }
 
-bool AbstractImporter::openFile(const std::string&) {
+bool AbstractImporter::doOpenFile(const std::string&) {
     CORRADE_ASSERT(features() & Feature::OpenFile,
-        "Trade::AbstractImporter::openFile(): feature advertised but not implemented", nullptr);
+        "Trade::AbstractImporter::openFile(): feature advertised but not implemented", false);
+
+    CORRADE_ASSERT(false, "Trade::AbstractImporter::openFile(): feature not implemented", false);
+}
 
-    CORRADE_ASSERT(false, "Trade::AbstractImporter::openFile(): feature not implemented", nullptr);
+void AbstractImporter::close() {
+    delete _nameIndex;
+    _nameIndex = nullptr;
 }
 
-Int AbstractImporter::sceneForName(const std::string&) { return -1; }
+Int AbstractImporter::forName(const std::size_t category, const UnsignedInt count, std::string(AbstractImporter::*const nameFunction)(UnsignedInt), const std::string& name) {
+    if(!_nameIndex) _nameIndex = new NameIndex;
+    NameIndex::Category& index = _nameIndex->categories[category];
+
+    /* Build the index on first query, it is discarded when another file is
+       opened */
+    if(!index.built) {
+        index.ids.reserve(count);
+        for(UnsignedInt i = 0; i != count; ++i) {
+            std::string entryName = (this->*nameFunction)(i);
+            /* emplace() doesn't overwrite, thus the lowest ID wins */
+            if(!entryName.empty()) index.ids.emplace(std::move(entryName), i);
+        }
+
+        index.built = true;
+    }
+
+    auto found = index.ids.find(name);
+    return found == index.ids.end() ? -1 : found->second;
+}
+
+Int AbstractImporter::sceneForName(const std::string& name) { return forName(SceneNames, sceneCount(), &AbstractImporter::sceneName, name); }
 std::string AbstractImporter::sceneName(UnsignedInt) { return {}; }
 SceneData* AbstractImporter::scene(UnsignedInt) { return nullptr; }
-Int AbstractImporter::lightForName(const std::string&) { return -1; }
+Int AbstractImporter::lightForName(const std::string& name) { return forName(LightNames, lightCount(), &AbstractImporter::lightName, name); }
 std::string AbstractImporter::lightName(UnsignedInt) { return {}; }
 LightData* AbstractImporter::light(UnsignedInt) { return nullptr; }
-Int AbstractImporter::cameraForName(const std::string&) { return -1; }
+Int AbstractImporter::cameraForName(const std::string& name) { return forName(CameraNames, cameraCount(), &AbstractImporter::cameraName, name); }
 std::string AbstractImporter::cameraName(UnsignedInt) { return {}; }
 CameraData* AbstractImporter::camera(UnsignedInt) { return nullptr; }
-Int AbstractImporter::object2DForName(const std::string&) { return -1; }
+Int AbstractImporter::object2DForName(const std::string& name) { return forName(Object2DNames, object2DCount(), &AbstractImporter::object2DName, name); }
 std::string AbstractImporter::object2DName(UnsignedInt) { return {}; }
 ObjectData2D* AbstractImporter::object2D(UnsignedInt) { return nullptr; }
-Int AbstractImporter::object3DForName(const std::string&) { return -1; }
+Int AbstractImporter::object3DForName(const std::string& name) { return forName(Object3DNames, object3DCount(), &AbstractImporter::object3DName, name); }
 std::string AbstractImporter::object3DName(UnsignedInt) { return {}; }
 ObjectData3D* AbstractImporter::object3D(UnsignedInt) { return nullptr; }
-Int AbstractImporter::mesh2DForName(const std::string&) { return -1; }
+Int AbstractImporter::mesh2DForName(const std::string& name) { return forName(Mesh2DNames, mesh2DCount(), &AbstractImporter::mesh2DName, name); }
 std::string AbstractImporter::mesh2DName(UnsignedInt) { return {}; }
 MeshData2D* AbstractImporter::mesh2D(UnsignedInt) { return nullptr; }
-Int AbstractImporter::mesh3DForName(const std::string&) { return -1; }
+Int AbstractImporter::mesh3DForName(const std::string& name) { return forName(Mesh3DNames, mesh3DCount(), &AbstractImporter::mesh3DName, name); }
 std::string AbstractImporter::mesh3DName(UnsignedInt) { return {}; }
 MeshData3D* AbstractImporter::mesh3D(UnsignedInt) { return nullptr; }
-Int AbstractImporter::materialForName(const std::string&) { return -1; }
+Int AbstractImporter::materialForName(const std::string& name) { return forName(MaterialNames, materialCount(), &AbstractImporter::materialName, name); }
 std::string AbstractImporter::materialName(UnsignedInt) { return {}; }
 AbstractMaterialData* AbstractImporter::material(UnsignedInt) { return nullptr; }
-Int AbstractImporter::textureForName(const std::string&) { return -1; }
+Int AbstractImporter::textureForName(const std::string& name) { return forName(TextureNames, textureCount(), &AbstractImporter::textureName, name); }
 std::string AbstractImporter::textureName(UnsignedInt) { return {}; }
 TextureData* AbstractImporter::texture(UnsignedInt) { return nullptr; }
-Int AbstractImporter::image1DForName(const std::string&) { return -1; }
+Int AbstractImporter::image1DForName(const std::string& name) { return forName(Image1DNames, image1DCount(), &AbstractImporter::image1DName, name); }
 std::string AbstractImporter::image1DName(UnsignedInt) { return {}; }
 ImageData1D* AbstractImporter::image1D(UnsignedInt) { return nullptr; }
-Int AbstractImporter::image2DForName(const std::string&) { return -1; }
+Int AbstractImporter::image2DForName(const std::string& name) { return forName(Image2DNames, image2DCount(), &AbstractImporter::image2DName, name); }
 std::string AbstractImporter::image2DName(UnsignedInt) { return {}; }
 ImageData2D* AbstractImporter::image2D(UnsignedInt) { return nullptr; }
-Int AbstractImporter::image3DForName(const std::string&) { return -1; }
+Int AbstractImporter::image3DForName(const std::string& name) { return forName(Image3DNames, image3DCount(), &AbstractImporter::image3DName, name); }
 std::string AbstractImporter::image3DName(UnsignedInt) { return {}; }
 ImageData3D* AbstractImporter::image3D(UnsignedInt) { return nullptr; }
 
+bool AbstractImporter::streamMesh3D(UnsignedInt, std::size_t, const Mesh3DChunkCallback&) {
+    CORRADE_ASSERT(!(features() & Feature::Streaming),
+        "Trade::AbstractImporter::streamMesh3D(): feature advertised but not implemented", false);
+
+    CORRADE_ASSERT(false, "Trade::AbstractImporter::streamMesh3D(): feature not implemented", false);
+}
+
+bool AbstractImporter::streamImage2D(UnsignedInt, std::size_t, const Image2DChunkCallback&) {
+    CORRADE_ASSERT(!(features() & Feature::Streaming),
+        "Trade::AbstractImporter::streamImage2D(): feature advertised but not implemented", false);
+
+    CORRADE_ASSERT(false, "Trade::AbstractImporter::streamImage2D(): feature not implemented", false);
+}
+
 }}
@@ -28,9 +28,11 @@
  * @brief Class Magnum::Trade::AbstractImporter
  */
 
+#include <functional>
 #include <Containers/EnumSet.h>
 #include <PluginManager/AbstractPlugin.h>
 
+#include "Magnum.h"
 #include "Trade/Trade.h"
 
 #include "magnumVisibility.h"
@@ -44,17 +46,42 @@ Importer is used for importing data like scenes, lights, objects, images,
 textures etc.
 
 @section AbstractImporter-subclassing Subclassing
-Plugin implements function features(), one or more open() functions,
-function close() and one or more pairs of data access functions, based on
-which features are supported in given format.
+Plugin implements function features(), one or more of doOpenData() and
+doOpenFile() functions, function close() and one or more pairs of data access
+functions, based on which features are supported in given format.
 
 For multi-data formats file opening shouldn't take long, all parsing should
 be done in data parsing functions, because the user might want to import only
 some data. This is obviously not the case for single-data formats like images,
 as the file contains all data user wants to import.
+
+Default implementation of each `*ForName()` function builds a hashed index of
+all names in given category on first use (using `*Count()` and `*Name()`
+functions) and then answers all subsequent queries from it, so there is
+usually no need to reimplement them. The index is discarded each time
+openData() or openFile() is called, before the plugin implementation opens
+the file, so the plugin doesn't need to do anything to keep it up to date.
+Entries with empty name are not indexed and if more entries share the same
+name, the one with lowest ID is returned.
+
+@section AbstractImporter-streaming Streaming import
+Importers advertising @ref Feature "Feature::Streaming" can deliver mesh and
+image data in pieces of bounded size using streamMesh3D() and streamImage2D()
+instead of materializing whole data at once. This allows processing assets
+larger than available memory, e.g. uploading them to GPU buffer piece by
+piece:
+@code
+importer->streamMesh3D(0, 1024*1024, [&](const Trade::MeshDataView3D& chunk, std::size_t offset) {
+    if(chunk.isIndexed())
+        indexBuffer.setSubData(offset*sizeof(UnsignedInt), chunk.indices().size()*sizeof(UnsignedInt), chunk.indices().data());
+    else
+        vertexBuffer.setSubData(offset*sizeof(Vector3), chunk.positions(0).size()*sizeof(Vector3), chunk.positions(0).data());
+    return true;
+});
+@endcode
 */
 class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlugin {
-    PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.2.1")
+    PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.2.2")
 
     public:
         /**
@@ -64,18 +91,46 @@ class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlu
          */
         enum class Feature: UnsignedByte {
             OpenData = 1 << 0,  /**< Opening files from raw data */
-            OpenFile = 1 << 1   /**< Opening files specified by filename */
+            OpenFile = 1 << 1,  /**< Opening files specified by filename */
+
+            /**
+             * Streaming mesh and image data in chunks
+             * @see streamMesh3D(), streamImage2D()
+             */
+            Streaming = 1 << 2
         };
 
         /** @brief Set of features supported by this importer */
         typedef Corrade::Containers::EnumSet<Feature, UnsignedByte> Features;
 
+        /**
+         * @brief Callback for streamed three-dimensional mesh chunk
+         *
+         * The first parameter is the chunk, the second is offset of its
+         * first vertex or first index in the whole mesh. Return `false` to
+         * abort the streaming.
+         * @see streamMesh3D()
+         */
+        typedef std::function<bool(const MeshDataView3D&, std::size_t)> Mesh3DChunkCallback;
+
+        /**
+         * @brief Callback for streamed two-dimensional image chunk
+         *
+         * The first parameter is the chunk containing full image rows, the
+         * second is index of its first row in the whole image. Return `false`
+         * to abort the streaming.
+         * @see streamImage2D()
+         */
+        typedef std::function<bool(const ImageWrapper2D&, Int)> Image2DChunkCallback;
+
         /** @brief Default constructor */
         explicit AbstractImporter();
 
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(Corrade::PluginManager::AbstractPluginManager* manager, std::string plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         virtual Features features() const = 0;
 
@@ -87,9 +142,9 @@ class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlu
          * Closes previous file, if it was opened, and tries to open given
          * file. Available only if @ref Feature "Feature::OpenData" is
          * supported. Returns `true` on success, `false` otherwise.
-         * @see features(), openFile()
+         * @see features(), openFile(), doOpenData()
          */
-        virtual bool openData(const void* const data, const std::size_t size);
+        bool openData(const void* const data, const std::size_t size);
 
         /**
          * @brief Open raw data
@@ -109,11 +164,18 @@ class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlu
          * Closes previous file, if it was opened, and tries to open given
          * file. Available only if @ref Feature "Feature::OpenFile" is
          * supported. Returns `true` on success, `false` otherwise.
-         * @see features(), openData()
+         * @see features(), openData(), doOpenFile()
          */
-        virtual bool openFile(const std::string& filename);
+        bool openFile(const std::string& filename);
 
-        /** @brief Close file */
+        /**
+         * @brief Close file
+         *
+         * Default implementation discards cached name indices, calling it
+         * from the plugin implementation only frees the memory earlier, see
+         * @ref AbstractImporter-subclassing "Subclassing" for more
+         * information.
+         */
         virtual void close() = 0;
 
         /** @{ @name Data accessors
@@ -327,6 +389,25 @@ class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlu
          */
         virtual MeshData3D* mesh3D(UnsignedInt id);
 
+        /**
+         * @brief Stream three-dimensional mesh
+         * @param id        %Mesh ID, from range [0, mesh3DCount()).
+         * @param chunkSize Maximal size of one chunk in bytes
+         * @param callback  Function called for each chunk
+         *
+         * Delivers given mesh in pieces with at most @p chunkSize bytes of
+         * data (but at least one vertex or index), so peak memory usage
+         * doesn't depend on mesh size. All vertex data are delivered first,
+         * each chunk containing the same range of vertices from all
+         * attribute arrays, then chunks with index data. The chunk data are
+         * valid only for the duration of the callback. Available only if
+         * @ref Feature "Feature::Streaming" is supported. Returns `true` if
+         * all data were delivered, `false` if import failed or the callback
+         * returned `false`.
+         * @see features(), mesh3D()
+         */
+        virtual bool streamMesh3D(UnsignedInt id, std::size_t chunkSize, const Mesh3DChunkCallback& callback);
+
         /** @brief Material count */
         virtual inline UnsignedInt materialCount() const { return 0; }
 
@@ -439,6 +520,19 @@ class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlu
          */
         virtual ImageData2D* image2D(UnsignedInt id);
 
+        /**
+         * @brief Stream two-dimensional image
+         * @param id        %Image ID, from range [0, image2DCount()).
+         * @param chunkSize Maximal size of one chunk in bytes
+         * @param callback  Function called for each chunk
+         *
+         * Delivers given image in pieces of full rows with at most
+         * @p chunkSize bytes of data (but at least one row), starting from
+         * the first row. See streamMesh3D() for more information.
+         * @see features(), image2D()
+         */
+        virtual bool streamImage2D(UnsignedInt id, std::size_t chunkSize, const Image2DChunkCallback& callback);
+
         /** @brief Three-dimensional image count */
         virtual inline UnsignedInt image3DCount() const { return 0; }
 
@@ -468,6 +562,27 @@ class MAGNUM_EXPORT AbstractImporter: public Corrade::PluginManager::AbstractPlu
         virtual ImageData3D* image3D(UnsignedInt id);
 
         /*@}*/
+
+    private:
+        struct NameIndex;
+
+        /**
+         * @brief Implementation for openData()
+         *
+         * Called after discarding the cached name indices.
+         */
+        virtual bool doOpenData(const void* const data, const std::size_t size);
+
+        /**
+         * @brief Implementation for openFile()
+         *
+         * Called after discarding the cached name indices.
+         */
+        virtual bool doOpenFile(const std::string& filename);
+
+        Int MAGNUM_LOCAL forName(std::size_t category, UnsignedInt count, std::string(AbstractImporter::*nameFunction)(UnsignedInt), const std::string& name);
+
+        NameIndex* _nameIndex;
 };
 
 CORRADE_ENUMSET_OPERATORS(AbstractImporter::Features)
@@ -0,0 +1,367 @@
+#ifndef Magnum_Trade_BatchImporter_h
+#define Magnum_Trade_BatchImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Trade::BatchImporter
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <Utility/Assert.h>
+#include <Utility/Debug.h>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Trade/AbstractImporter.h"
+
+namespace Magnum { namespace Trade {
+
+namespace Implementation {
+    template<class> struct BatchImporterTraits;
+
+    #define MAGNUM_BATCHIMPORTER_TRAITS(Type, function)                     \
+        template<> struct BatchImporterTraits<Type> {                       \
+            inline static UnsignedInt count(AbstractImporter& importer) {   \
+                return importer.function##Count();                          \
+            }                                                               \
+            inline static Type* get(AbstractImporter& importer, UnsignedInt id) { \
+                return importer.function(id);                               \
+            }                                                               \
+            inline constexpr static const char* name() { return #function; } \
+        };
+    MAGNUM_BATCHIMPORTER_TRAITS(SceneData, scene)
+    MAGNUM_BATCHIMPORTER_TRAITS(LightData, light)
+    MAGNUM_BATCHIMPORTER_TRAITS(CameraData, camera)
+    MAGNUM_BATCHIMPORTER_TRAITS(ObjectData2D, object2D)
+    MAGNUM_BATCHIMPORTER_TRAITS(ObjectData3D, object3D)
+    MAGNUM_BATCHIMPORTER_TRAITS(MeshData2D, mesh2D)
+    MAGNUM_BATCHIMPORTER_TRAITS(MeshData3D, mesh3D)
+    MAGNUM_BATCHIMPORTER_TRAITS(AbstractMaterialData, material)
+    MAGNUM_BATCHIMPORTER_TRAITS(TextureData, texture)
+    MAGNUM_BATCHIMPORTER_TRAITS(ImageData1D, image1D)
+    MAGNUM_BATCHIMPORTER_TRAITS(ImageData2D, image2D)
+    MAGNUM_BATCHIMPORTER_TRAITS(ImageData3D, image3D)
+    #undef MAGNUM_BATCHIMPORTER_TRAITS
+}
+
+/**
+@brief Parallel batch importer
+@tparam T   Imported data type, e.g. MeshData3D or ImageData2D
+
+Imports many items of the same type on a pool of worker threads. Importer
+plugins are not thread-safe, so each worker thread has its own importer
+instance, created with given factory function on the thread which constructs
+the batch importer. Each worker keeps its file opened, so consecutive items
+from the same file don't need to reopen it.
+
+The items are requested with add() and results are taken with next() in the
+same order as they were requested, regardless of which worker finished first.
+To bound memory usage, the count of items which are being imported or were
+imported but not yet taken with next() can be limited. Example usage:
+@code
+PluginManager::PluginManager<Trade::AbstractImporter> manager(MAGNUM_PLUGINS_IMPORTER_DIR);
+Trade::BatchImporter<Trade::MeshData3D> importer([&manager]() {
+    return manager.instance("ColladaImporter");
+}, Trade::BatchImporter<Trade::MeshData3D>::defaultThreadCount(), 64);
+
+for(UnsignedInt i = 0; i != meshCount; ++i)
+    importer.add("level.dae", i);
+
+while(importer.pendingCount()) {
+    Trade::MeshData3D* data = importer.next();
+    // upload the data to GPU...
+    delete data;
+}
+@endcode
+
+If the importer is constructed with zero threads (and always when targeting
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten"), no threads are spawned and the
+items are imported on the calling thread in next().
+*/
+template<class T> class BatchImporter {
+    BatchImporter(const BatchImporter<T>&) = delete;
+    BatchImporter(BatchImporter<T>&&) = delete;
+    BatchImporter<T>& operator=(const BatchImporter<T>&) = delete;
+    BatchImporter<T>& operator=(BatchImporter<T>&&) = delete;
+
+    public:
+        /**
+         * @brief Importer factory
+         *
+         * Returns new importer instance, which is then owned by the batch
+         * importer.
+         */
+        typedef std::function<AbstractImporter*()> Factory;
+
+        /**
+         * @brief Default count of worker threads
+         *
+         * Count of hardware threads, at least `1`. Returns `0` when targeting
+         * @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        static UnsignedInt defaultThreadCount();
+
+        /**
+         * @brief Constructor
+         * @param factory       Importer factory, called once for each thread
+         *      (or once if @p threadCount is `0`)
+         * @param threadCount   Count of worker threads. If set to `0`, the
+         *      items are imported on the calling thread in next().
+         * @param maxInFlight   Max count of items which are being imported
+         *      or are not yet taken with next(). Set to `0` for no limit.
+         *
+         * The threads are spawned immediately.
+         */
+        explicit BatchImporter(Factory factory, UnsignedInt threadCount = defaultThreadCount(), std::size_t maxInFlight = 0);
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for running imports, discards queued items, deletes results
+         * which were not taken and deletes the importer instances.
+         */
+        ~BatchImporter();
+
+        /** @brief Count of worker threads */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Count of pending items
+         *
+         * Count of items requested with add() which were not yet taken with
+         * next().
+         */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Request item import
+         * @param filename  File to import from
+         * @param id        Item ID in the file
+         * @return Sequence number of the item, counted from zero. Results
+         *      are returned from next() in the same order.
+         */
+        std::size_t add(std::string filename, UnsignedInt id);
+
+        /**
+         * @brief Request import of more items from the same file
+         *
+         * Same as calling add(std::string, UnsignedInt) for each ID.
+         */
+        void add(const std::string& filename, const std::vector<UnsignedInt>& ids);
+
+        /**
+         * @brief Take next result
+         *
+         * Blocks until the first item which was not yet taken is imported
+         * and returns it. Returns `nullptr` if the file cannot be opened,
+         * the ID is out of range or the import failed. Deleting the data is
+         * user responsibility. Expects that pendingCount() is not zero.
+         */
+        T* next();
+
+    private:
+        struct Job {
+            inline explicit Job(std::string filename, UnsignedInt id): filename(std::move(filename)), id(id), data(nullptr), done(false) {}
+
+            std::string filename;
+            UnsignedInt id;
+            T* data;
+            bool done;
+        };
+
+        static T* import(AbstractImporter& importer, std::string& opened, const std::string& filename, UnsignedInt id);
+
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void worker(std::size_t index);
+        #endif
+
+        mutable std::mutex _mutex;
+        std::condition_variable _jobAvailable, _jobDone;
+
+        /* Jobs which were not yet taken, in order of requests. Deque keeps
+           references valid while new jobs are added, so the workers can
+           access the job without holding the lock. */
+        std::deque<Job> _jobs;
+        std::size_t _taken, _started, _maxInFlight;
+
+        std::vector<AbstractImporter*> _importers;
+        std::vector<std::string> _opened;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::vector<std::thread> _threads;
+        #endif
+        bool _quit;
+};
+
+template<class T> UnsignedInt BatchImporter<T>::defaultThreadCount() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return std::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    return 0;
+    #endif
+}
+
+template<class T> BatchImporter<T>::BatchImporter(Factory factory, UnsignedInt threadCount, std::size_t maxInFlight): _taken(0), _started(0), _maxInFlight(maxInFlight), _quit(false) {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    threadCount = 0;
+    #endif
+
+    /* Importers are created on this thread, as plugin manager is not
+       thread-safe */
+    const std::size_t importerCount = std::max(threadCount, 1u);
+    _importers.reserve(importerCount);
+    for(std::size_t i = 0; i != importerCount; ++i)
+        _importers.push_back(factory());
+    _opened.resize(importerCount);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _threads.reserve(threadCount);
+    for(std::size_t i = 0; i != threadCount; ++i)
+        _threads.emplace_back(&BatchImporter<T>::worker, this, i);
+    #endif
+}
+
+template<class T> BatchImporter<T>::~BatchImporter() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _jobAvailable.notify_all();
+    for(std::thread& thread: _threads) thread.join();
+    #endif
+
+    for(const Job& job: _jobs) delete job.data;
+    for(AbstractImporter* importer: _importers) delete importer;
+}
+
+template<class T> UnsignedInt BatchImporter<T>::threadCount() const {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return _threads.size();
+    #else
+    return 0;
+    #endif
+}
+
+template<class T> std::size_t BatchImporter<T>::pendingCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _jobs.size();
+}
+
+template<class T> std::size_t BatchImporter<T>::add(std::string filename, UnsignedInt id) {
+    std::size_t index;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.emplace_back(std::move(filename), id);
+        index = _taken + _jobs.size() - 1;
+    }
+
+    _jobAvailable.notify_one();
+    return index;
+}
+
+template<class T> void BatchImporter<T>::add(const std::string& filename, const std::vector<UnsignedInt>& ids) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for(UnsignedInt id: ids) _jobs.emplace_back(filename, id);
+    }
+
+    _jobAvailable.notify_all();
+}
+
+template<class T> T* BatchImporter<T>::next() {
+    T* data;
+
+    /* Import on calling thread */
+    if(!threadCount()) {
+        CORRADE_ASSERT(!_jobs.empty(), "Trade::BatchImporter::next(): no pending items", nullptr);
+        data = import(*_importers[0], _opened[0], _jobs.front().filename, _jobs.front().id);
+        _jobs.pop_front();
+        ++_taken;
+        ++_started;
+        return data;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        CORRADE_ASSERT(!_jobs.empty(), "Trade::BatchImporter::next(): no pending items", nullptr);
+        _jobDone.wait(lock, [this]() { return _jobs.front().done; });
+        data = _jobs.front().data;
+        _jobs.pop_front();
+        ++_taken;
+    }
+
+    /* Taking the result might free space for next job */
+    if(_maxInFlight) _jobAvailable.notify_one();
+    return data;
+}
+
+template<class T> T* BatchImporter<T>::import(AbstractImporter& importer, std::string& opened, const std::string& filename, UnsignedInt id) {
+    if(opened != filename) {
+        opened.clear();
+        if(!importer.openFile(filename)) return nullptr;
+        opened = filename;
+    }
+
+    if(id >= Implementation::BatchImporterTraits<T>::count(importer)) {
+        Error() << "Trade::BatchImporter:" << Implementation::BatchImporterTraits<T>::name() << id << "not found in" << filename;
+        return nullptr;
+    }
+
+    return Implementation::BatchImporterTraits<T>::get(importer, id);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+template<class T> void BatchImporter<T>::worker(const std::size_t index) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    for(;;) {
+        _jobAvailable.wait(lock, [this]() {
+            return _quit || (_started != _taken + _jobs.size() && (!_maxInFlight || _started - _taken < _maxInFlight));
+        });
+        if(_quit) return;
+
+        Job& job = _jobs[_started++ - _taken];
+        lock.unlock();
+
+        T* data = import(*_importers[index], _opened[index], job.filename, job.id);
+
+        lock.lock();
+        job.data = data;
+        job.done = true;
+        _jobDone.notify_all();
+    }
+}
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,236 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlobConverter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <Utility/Debug.h>
+
+#include "Math/Vector3.h"
+#include "Trade/AbstractImporter.h"
+#include "Trade/ImageData.h"
+#include "Trade/MeshData2D.h"
+#include "Trade/MeshData3D.h"
+#include "Trade/MeshObjectData3D.h"
+#include "Trade/SceneData.h"
+#include "Trade/Implementation/BlobFormat.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Implementation;
+
+namespace {
+
+struct Array {
+    template<class T> inline Array(const std::vector<T>& data): data(data.data()), size(data.size()), byteSize(data.size()*sizeof(T)) {}
+
+    const void* data;
+    std::size_t size;
+    std::size_t byteSize;
+};
+
+std::size_t arraysSize(const std::vector<Array>& arrays) {
+    std::size_t size = blobAlign(sizeof(BlobMesh) + arrays.size()*sizeof(UnsignedInt));
+    for(const Array& array: arrays) size += blobAlign(array.byteSize);
+    return size;
+}
+
+void writeArrays(char* out, const std::vector<Array>& arrays) {
+    UnsignedInt* sizes = reinterpret_cast<UnsignedInt*>(out + sizeof(BlobMesh));
+    char* data = out + blobAlign(sizeof(BlobMesh) + arrays.size()*sizeof(UnsignedInt));
+    for(const Array& array: arrays) {
+        *sizes++ = array.size;
+        if(array.byteSize) std::memcpy(data, array.data, array.byteSize);
+        data += blobAlign(array.byteSize);
+    }
+}
+
+}
+
+BlobConverter::BlobConverter(): _counts(), _defaultScene(-1) {}
+
+std::pair<UnsignedInt, char*> BlobConverter::add(const UnsignedInt type, const std::string& name, const std::size_t size) {
+    _entries.push_back({type, name, std::vector<char>(size)});
+    return {_counts[type]++, _entries.back().payload.data()};
+}
+
+UnsignedInt BlobConverter::addScene(const SceneData& scene, const std::string& name) {
+    const std::size_t children2DSize = scene.children2D().size()*sizeof(UnsignedInt);
+    const std::size_t children3DSize = scene.children3D().size()*sizeof(UnsignedInt);
+    auto entry = add(UnsignedInt(BlobEntryType::Scene), name, sizeof(BlobScene) + children2DSize + children3DSize);
+
+    BlobScene& header = *reinterpret_cast<BlobScene*>(entry.second);
+    header.children2DCount = scene.children2D().size();
+    header.children3DCount = scene.children3D().size();
+    UnsignedInt* children = reinterpret_cast<UnsignedInt*>(entry.second + sizeof(BlobScene));
+    std::copy(scene.children3D().begin(), scene.children3D().end(),
+        std::copy(scene.children2D().begin(), scene.children2D().end(), children));
+    return entry.first;
+}
+
+UnsignedInt BlobConverter::addObject3D(const ObjectData3D& object, const std::string& name) {
+    const std::size_t childrenSize = object.children().size()*sizeof(UnsignedInt);
+    auto entry = add(UnsignedInt(BlobEntryType::Object3D), name, sizeof(BlobObject3D) + childrenSize);
+
+    BlobObject3D& header = *reinterpret_cast<BlobObject3D*>(entry.second);
+    std::memcpy(header.transformation, object.transformation().data(), sizeof(header.transformation));
+    header.instanceType = UnsignedInt(object.instanceType());
+    header.instanceId = object.instanceId();
+    header.material = object.instanceType() == ObjectData3D::InstanceType::Mesh ?
+        static_cast<const MeshObjectData3D&>(object).material() : 0;
+    header.childrenCount = object.children().size();
+    std::copy(object.children().begin(), object.children().end(), reinterpret_cast<UnsignedInt*>(entry.second + sizeof(BlobObject3D)));
+    return entry.first;
+}
+
+UnsignedInt BlobConverter::addMesh2D(const MeshData2D& mesh, const std::string& name) {
+    std::vector<Array> arrays;
+    if(mesh.indices()) arrays.push_back(*mesh.indices());
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        arrays.push_back(*mesh.positions(i));
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        arrays.push_back(*mesh.textureCoords2D(i));
+
+    auto entry = add(UnsignedInt(BlobEntryType::Mesh2D), name, arraysSize(arrays));
+    BlobMesh& header = *reinterpret_cast<BlobMesh*>(entry.second);
+    header.primitive = UnsignedInt(mesh.primitive());
+    header.indexed = mesh.indices() ? 1 : 0;
+    header.positionArrayCount = mesh.positionArrayCount();
+    header.normalArrayCount = 0;
+    header.textureCoords2DArrayCount = mesh.textureCoords2DArrayCount();
+    writeArrays(entry.second, arrays);
+    return entry.first;
+}
+
+UnsignedInt BlobConverter::addMesh3D(const MeshData3D& mesh, const std::string& name) {
+    std::vector<Array> arrays;
+    if(mesh.indices()) arrays.push_back(*mesh.indices());
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        arrays.push_back(*mesh.positions(i));
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        arrays.push_back(*mesh.normals(i));
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        arrays.push_back(*mesh.textureCoords2D(i));
+
+    auto entry = add(UnsignedInt(BlobEntryType::Mesh3D), name, arraysSize(arrays));
+    BlobMesh& header = *reinterpret_cast<BlobMesh*>(entry.second);
+    header.primitive = UnsignedInt(mesh.primitive());
+    header.indexed = mesh.indices() ? 1 : 0;
+    header.positionArrayCount = mesh.positionArrayCount();
+    header.normalArrayCount = mesh.normalArrayCount();
+    header.textureCoords2DArrayCount = mesh.textureCoords2DArrayCount();
+    writeArrays(entry.second, arrays);
+    return entry.first;
+}
+
+UnsignedInt BlobConverter::addImage2D(const ImageData2D& image, const std::string& name) {
+    const std::size_t dataSize = AbstractImage::pixelSize(image.format(), image.type())*image.size().product();
+    auto entry = add(UnsignedInt(BlobEntryType::Image2D), name, sizeof(BlobImage2D) + dataSize);
+
+    BlobImage2D& header = *reinterpret_cast<BlobImage2D*>(entry.second);
+    header.size[0] = image.size().x();
+    header.size[1] = image.size().y();
+    header.format = UnsignedInt(image.format());
+    header.type = UnsignedInt(image.type());
+    header.dataSize = dataSize;
+    std::memcpy(entry.second + sizeof(BlobImage2D), image.data(), dataSize);
+    return entry.first;
+}
+
+template<class T> bool BlobConverter::addAll(AbstractImporter* importer, UnsignedInt(AbstractImporter::*count)() const, T*(AbstractImporter::*get)(UnsignedInt), std::string(AbstractImporter::*name)(UnsignedInt), UnsignedInt(BlobConverter::*add)(const T&, const std::string&), const char* what) {
+    for(UnsignedInt i = 0; i != (importer->*count)(); ++i) {
+        T* data = (importer->*get)(i);
+        if(!data) {
+            Error() << "Trade::BlobConverter::addImporter(): cannot import" << what << i;
+            return false;
+        }
+
+        (this->*add)(*data, (importer->*name)(i));
+        delete data;
+    }
+
+    return true;
+}
+
+bool BlobConverter::addImporter(AbstractImporter* importer) {
+    CORRADE_ASSERT(_entries.empty(),
+        "Trade::BlobConverter::addImporter(): the converter is not empty", false);
+
+    if(!addAll(importer, &AbstractImporter::sceneCount, &AbstractImporter::scene, &AbstractImporter::sceneName, &BlobConverter::addScene, "scene") ||
+       !addAll(importer, &AbstractImporter::object3DCount, &AbstractImporter::object3D, &AbstractImporter::object3DName, &BlobConverter::addObject3D, "3D object") ||
+       !addAll(importer, &AbstractImporter::mesh2DCount, &AbstractImporter::mesh2D, &AbstractImporter::mesh2DName, &BlobConverter::addMesh2D, "2D mesh") ||
+       !addAll(importer, &AbstractImporter::mesh3DCount, &AbstractImporter::mesh3D, &AbstractImporter::mesh3DName, &BlobConverter::addMesh3D, "3D mesh") ||
+       !addAll(importer, &AbstractImporter::image2DCount, &AbstractImporter::image2D, &AbstractImporter::image2DName, &BlobConverter::addImage2D, "2D image"))
+        return false;
+
+    _defaultScene = importer->defaultScene();
+    return true;
+}
+
+std::vector<char> BlobConverter::convertToData() const {
+    /* Compute offsets of names and payloads */
+    std::vector<BlobEntry> entries(_entries.size());
+    std::size_t offset = blobAlign(sizeof(BlobHeader) + _entries.size()*sizeof(BlobEntry));
+    for(std::size_t i = 0; i != _entries.size(); ++i) {
+        entries[i].type = BlobEntryType(_entries[i].type);
+        entries[i].nameSize = _entries[i].name.size();
+        entries[i].nameOffset = offset;
+        offset = blobAlign(offset + _entries[i].name.size());
+        entries[i].offset = offset;
+        entries[i].size = _entries[i].payload.size();
+        offset = blobAlign(offset + _entries[i].payload.size());
+    }
+
+    std::vector<char> out(offset);
+    BlobHeader& header = *reinterpret_cast<BlobHeader*>(out.data());
+    std::memcpy(header.magic, "MGBL", 4);
+    header.version = BlobVersion;
+    header.endianness = BlobEndianness;
+    header.entryCount = _entries.size();
+    header.defaultScene = _defaultScene;
+
+    if(!entries.empty()) std::memcpy(out.data() + sizeof(BlobHeader), entries.data(), entries.size()*sizeof(BlobEntry));
+    for(std::size_t i = 0; i != _entries.size(); ++i) {
+        std::copy(_entries[i].name.begin(), _entries[i].name.end(), out.begin() + entries[i].nameOffset);
+        std::copy(_entries[i].payload.begin(), _entries[i].payload.end(), out.begin() + entries[i].offset);
+    }
+
+    return out;
+}
+
+bool BlobConverter::convertToFile(const std::string& filename) const {
+    std::ofstream out(filename, std::ofstream::binary);
+    if(!out.good()) {
+        Error() << "Trade::BlobConverter::convertToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    const std::vector<char> data = convertToData();
+    out.write(data.data(), data.size());
+    return true;
+}
+
+}}
@@ -0,0 +1,146 @@
+#ifndef Magnum_Trade_BlobConverter_h
+#define Magnum_Trade_BlobConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Trade::BlobConverter
+ */
+
+#include <string>
+#include <vector>
+
+#include "Trade/Trade.h"
+#include "magnumVisibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Converter to Magnum blob format
+
+Serializes scenes, objects, meshes and images into binary format which can be
+then loaded with BlobImporter without any parsing. The data can be added one
+by one, or baked from any importer using addImporter():
+@code
+Trade::AbstractImporter* importer = ...;
+importer->openFile("scene.dae");
+
+Trade::BlobConverter converter;
+converter.addImporter(importer);
+converter.convertToFile("scene.blob");
+@endcode
+
+The format uses native byte order and BlobImporter refuses to open files with
+different endianness.
+@see BlobImporter
+*/
+class MAGNUM_EXPORT BlobConverter {
+    public:
+        explicit BlobConverter();
+
+        /** @brief Count of added entries */
+        inline std::size_t entryCount() const { return _entries.size(); }
+
+        /**
+         * @brief Set default scene
+         *
+         * Default is `-1`, i.e. no default scene.
+         */
+        inline BlobConverter& setDefaultScene(Int id) {
+            _defaultScene = id;
+            return *this;
+        }
+
+        /**
+         * @brief Add scene
+         * @return ID of added scene
+         */
+        UnsignedInt addScene(const SceneData& scene, const std::string& name = {});
+
+        /**
+         * @brief Add three-dimensional object
+         * @return ID of added object
+         *
+         * If the object is a mesh instance, it is expected to be
+         * MeshObjectData3D and its material ID is saved too.
+         */
+        UnsignedInt addObject3D(const ObjectData3D& object, const std::string& name = {});
+
+        /**
+         * @brief Add two-dimensional mesh
+         * @return ID of added mesh
+         */
+        UnsignedInt addMesh2D(const MeshData2D& mesh, const std::string& name = {});
+
+        /**
+         * @brief Add three-dimensional mesh
+         * @return ID of added mesh
+         */
+        UnsignedInt addMesh3D(const MeshData3D& mesh, const std::string& name = {});
+
+        /**
+         * @brief Add two-dimensional image
+         * @return ID of added image
+         */
+        UnsignedInt addImage2D(const ImageData2D& image, const std::string& name = {});
+
+        /**
+         * @brief Add all supported data from given importer
+         * @return `False` if importing any of the data failed, `true`
+         *      otherwise.
+         *
+         * Adds all scenes, three-dimensional objects, meshes and
+         * two-dimensional images together with their names and sets default
+         * scene. The IDs are preserved, so it is meant to be used on empty
+         * converter.
+         */
+        bool addImporter(AbstractImporter* importer);
+
+        /** @brief Convert added data to blob in memory */
+        std::vector<char> convertToData() const;
+
+        /**
+         * @brief Convert added data to blob file
+         * @return `False` if the file cannot be written, `true` otherwise.
+         */
+        bool convertToFile(const std::string& filename) const;
+
+    private:
+        struct Entry {
+            UnsignedInt type;
+            std::string name;
+            std::vector<char> payload;
+        };
+
+        std::pair<UnsignedInt, char*> add(UnsignedInt type, const std::string& name, std::size_t size);
+        template<class T> bool addAll(AbstractImporter* importer, UnsignedInt(AbstractImporter::*count)() const, T*(AbstractImporter::*get)(UnsignedInt), std::string(AbstractImporter::*name)(UnsignedInt), UnsignedInt(BlobConverter::*add)(const T&, const std::string&), const char* what);
+
+        std::vector<Entry> _entries;
+        UnsignedInt _counts[5]; /* Count of entries of each type */
+        Int _defaultScene;
+};
+
+}}
+
+#endif
@@ -0,0 +1,698 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlobImporter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <Utility/Debug.h>
+
+#if !defined(_WIN32) && !defined(CORRADE_TARGET_NACL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAGNUM_BLOBIMPORTER_USE_MMAP
+#endif
+
+#include "ImageWrapper.h"
+#include "Math/Vector3.h"
+#include "Trade/ImageData.h"
+#include "Trade/MeshData2D.h"
+#include "Trade/MeshData3D.h"
+#include "Trade/MeshDataView2D.h"
+#include "Trade/MeshDataView3D.h"
+#include "Trade/MeshObjectData3D.h"
+#include "Trade/SceneData.h"
+#include "Trade/Implementation/BlobFormat.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Implementation;
+
+namespace {
+
+/* Reads the arrays written by BlobConverter, expects that the sizes were
+   validated */
+class ArrayReader {
+    public:
+        inline explicit ArrayReader(const char* payload, std::size_t arrayCount): sizes(reinterpret_cast<const UnsignedInt*>(payload + sizeof(BlobMesh))), data(payload + blobAlign(sizeof(BlobMesh) + arrayCount*sizeof(UnsignedInt))) {}
+
+        template<class T> std::vector<T>* next() {
+            const T* begin = reinterpret_cast<const T*>(data);
+            const UnsignedInt size = *sizes++;
+            data += blobAlign(size*sizeof(T));
+            return new std::vector<T>(begin, begin + size);
+        }
+
+        template<class T> std::vector<std::vector<T>*> next(UnsignedInt count) {
+            std::vector<std::vector<T>*> arrays(count);
+            for(auto& array: arrays) array = next<T>();
+            return arrays;
+        }
+
+        /* The mapping is writable and memory passed to openData() is
+           expected to be writable if the views are modified, see
+           mesh3DView() */
+        template<class T> StridedArrayView<T> nextView() {
+            T* begin = reinterpret_cast<T*>(const_cast<char*>(data));
+            const UnsignedInt size = *sizes++;
+            data += blobAlign(size*sizeof(T));
+            return StridedArrayView<T>(begin, size);
+        }
+
+        template<class T> std::vector<StridedArrayView<T>> nextView(UnsignedInt count) {
+            std::vector<StridedArrayView<T>> views(count);
+            for(auto& view: views) view = nextView<T>();
+            return views;
+        }
+
+    private:
+        const UnsignedInt* sizes;
+        const char* data;
+};
+
+/* Size of mesh payload, assumes that there is enough data for the header and
+   size table */
+std::size_t meshSize(const char* payload, std::size_t vertexSize) {
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(payload);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount;
+    const UnsignedInt* sizes = reinterpret_cast<const UnsignedInt*>(payload + sizeof(BlobMesh));
+
+    std::size_t size = blobAlign(sizeof(BlobMesh) + arrayCount*sizeof(UnsignedInt));
+    for(std::size_t i = 0; i != arrayCount; ++i) {
+        const bool isIndexArray = header.indexed && i == 0;
+        const bool isTextureCoordsArray = i >= arrayCount - header.textureCoords2DArrayCount;
+        size += blobAlign(sizes[i]*(isIndexArray ? sizeof(UnsignedInt) : isTextureCoordsArray ? sizeof(Vector2) : vertexSize));
+    }
+    return size;
+}
+
+/* Whether the value is known Mesh::Primitive */
+bool isValidPrimitive(const UnsignedInt primitive) {
+    switch(Mesh::Primitive(primitive)) {
+        case Mesh::Primitive::Points:
+        case Mesh::Primitive::LineStrip:
+        case Mesh::Primitive::LineLoop:
+        case Mesh::Primitive::Lines:
+        #ifndef MAGNUM_TARGET_GLES
+        case Mesh::Primitive::LineStripAdjacency:
+        case Mesh::Primitive::LinesAdjacency:
+        #endif
+        case Mesh::Primitive::TriangleStrip:
+        case Mesh::Primitive::TriangleFan:
+        case Mesh::Primitive::Triangles:
+        #ifndef MAGNUM_TARGET_GLES
+        case Mesh::Primitive::TriangleStripAdjacency:
+        case Mesh::Primitive::TrianglesAdjacency:
+        case Mesh::Primitive::Patches:
+        #endif
+            return true;
+    }
+
+    return false;
+}
+
+/* Same as AbstractImage::pixelSize(), but for values coming from the file.
+   Returns 0 instead of asserting on unknown format or type or on depth and
+   stencil formats with component types. */
+std::size_t imagePixelSize(const UnsignedInt format, const UnsignedInt type) {
+    std::size_t size = 0;
+    switch(AbstractImage::Type(type)) {
+        case AbstractImage::Type::UnsignedByte:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Type::Byte:
+        #endif
+        case AbstractImage::Type::UnsignedShort:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Type::Short:
+        #endif
+        case AbstractImage::Type::HalfFloat:
+        case AbstractImage::Type::UnsignedInt:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Type::Int:
+        #endif
+        case AbstractImage::Type::Float:
+            break;
+
+        #ifndef MAGNUM_TARGET_GLES
+        case AbstractImage::Type::UnsignedByte332:
+        case AbstractImage::Type::UnsignedByte233Rev:
+        #endif
+        case AbstractImage::Type::UnsignedShort565:
+        #ifndef MAGNUM_TARGET_GLES
+        case AbstractImage::Type::UnsignedShort565Rev:
+        #endif
+        case AbstractImage::Type::UnsignedShort4444:
+        #ifndef MAGNUM_TARGET_GLES3
+        case AbstractImage::Type::UnsignedShort4444Rev:
+        #endif
+        case AbstractImage::Type::UnsignedShort5551:
+        #ifndef MAGNUM_TARGET_GLES3
+        case AbstractImage::Type::UnsignedShort1555Rev:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case AbstractImage::Type::UnsignedInt8888:
+        case AbstractImage::Type::UnsignedInt8888Rev:
+        case AbstractImage::Type::UnsignedInt1010102:
+        #endif
+        case AbstractImage::Type::UnsignedInt2101010Rev:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Type::UnsignedInt10F11F11FRev:
+        case AbstractImage::Type::UnsignedInt5999Rev:
+        #endif
+        case AbstractImage::Type::UnsignedInt248:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Type::Float32UnsignedInt248Rev:
+        #endif
+            /* Packed types don't depend on the format */
+            return AbstractImage::pixelSize(AbstractImage::Format::RGBA, AbstractImage::Type(type));
+
+        default: return 0;
+    }
+
+    switch(AbstractImage::Format(format)) {
+        case AbstractImage::Format::Red:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Format::RedInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case AbstractImage::Format::Green:
+        case AbstractImage::Format::Blue:
+        case AbstractImage::Format::GreenInteger:
+        case AbstractImage::Format::BlueInteger:
+        #endif
+        case AbstractImage::Format::RG:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Format::RGInteger:
+        #endif
+        case AbstractImage::Format::RGB:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Format::RGBInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case AbstractImage::Format::BGR:
+        case AbstractImage::Format::BGRInteger:
+        #endif
+        case AbstractImage::Format::RGBA:
+        #ifndef MAGNUM_TARGET_GLES2
+        case AbstractImage::Format::RGBAInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES3
+        case AbstractImage::Format::BGRA:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case AbstractImage::Format::BGRAInteger:
+        #endif
+            size = AbstractImage::pixelSize(AbstractImage::Format(format), AbstractImage::Type(type));
+            break;
+
+        default: return 0;
+    }
+
+    return size;
+}
+
+/* Whether the image header is consistent and the pixel data fit into the
+   entry */
+bool isValidImage(const BlobImage2D& header, const std::size_t entrySize) {
+    if(header.size[0] < 0 || header.size[1] < 0 || header.dataSize > entrySize - sizeof(BlobImage2D))
+        return false;
+
+    /* Dividing the data size, as multiplying the pixel count could overflow */
+    const std::size_t pixelSize = imagePixelSize(header.format, header.type);
+    return pixelSize && header.dataSize % pixelSize == 0 && header.dataSize/pixelSize == UnsignedLong(header.size[0])*UnsignedLong(header.size[1]);
+}
+
+}
+
+BlobImporter::BlobImporter(): _data(nullptr), _size(0), _mapped(false) {}
+
+BlobImporter::~BlobImporter() { close(); }
+
+auto BlobImporter::features() const -> Features { return Feature::OpenData|Feature::OpenFile|Feature::Streaming; }
+
+bool BlobImporter::doOpenData(const void* const data, const std::size_t size) {
+    close();
+
+    /* The data are referenced directly, unless they aren't aligned enough for
+       the arrays to be accessed in place */
+    if(reinterpret_cast<std::uintptr_t>(data) % BlobAlignment) {
+        _copy.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+        _data = _copy.data();
+    } else _data = static_cast<const char*>(data);
+    _size = size;
+    return openInternal();
+}
+
+bool BlobImporter::doOpenFile(const std::string& filename) {
+    close();
+
+    #ifdef MAGNUM_BLOBIMPORTER_USE_MMAP
+    const int fd = ::open(filename.data(), O_RDONLY);
+    struct stat st;
+    if(fd == -1 || fstat(fd, &st) == -1) {
+        if(fd != -1) ::close(fd);
+        Error() << "Trade::BlobImporter::openFile(): cannot open file" << filename;
+        return false;
+    }
+
+    /* The mapping is kept after closing the descriptor */
+    void* data = st.st_size ? mmap(nullptr, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if(data == MAP_FAILED) {
+        Error() << "Trade::BlobImporter::openFile(): cannot map file" << filename;
+        return false;
+    }
+
+    _data = static_cast<const char*>(data);
+    _size = st.st_size;
+    _mapped = true;
+    _filename = filename;
+    #else
+    /* Nothing to map, the whole file has to be read into memory */
+    std::ifstream in(filename, std::ifstream::binary);
+    if(!in.good()) {
+        Error() << "Trade::BlobImporter::openFile(): cannot open file" << filename;
+        return false;
+    }
+
+    in.seekg(0, std::ios::end);
+    _copy.resize(std::size_t(in.tellg()));
+    in.seekg(0, std::ios::beg);
+    in.read(_copy.data(), _copy.size());
+    _data = _copy.data();
+    _size = _copy.size();
+    #endif
+
+    return openInternal();
+}
+
+bool BlobImporter::openInternal() {
+    if(_size < sizeof(BlobHeader) || std::memcmp(_data, "MGBL", 4) != 0) {
+        Error() << "Trade::BlobImporter: not a Magnum blob";
+        close();
+        return false;
+    }
+
+    const BlobHeader& header = *reinterpret_cast<const BlobHeader*>(_data);
+
+    if(header.endianness != BlobEndianness) {
+        Error() << "Trade::BlobImporter: unsupported endianness";
+        close();
+        return false;
+    }
+
+    if(header.version != BlobVersion) {
+        Error() << "Trade::BlobImporter: unsupported version" << header.version;
+        close();
+        return false;
+    }
+
+    /* Validate and sort entries by type */
+    const BlobEntry* entries = reinterpret_cast<const BlobEntry*>(_data + sizeof(BlobHeader));
+    if(header.entryCount > (_size - sizeof(BlobHeader))/sizeof(BlobEntry)) {
+        Error() << "Trade::BlobImporter: file too short";
+        close();
+        return false;
+    }
+    for(std::size_t i = 0; i != header.entryCount; ++i) {
+        const BlobEntry& entry = entries[i];
+        /* Comparing against remaining size, as the sums could overflow */
+        if(UnsignedInt(entry.type) >= BlobEntryTypeCount ||
+           entry.nameOffset > _size || entry.nameSize > _size - entry.nameOffset ||
+           entry.offset > _size || entry.size > _size - entry.offset ||
+           entry.offset % BlobAlignment) {
+            Error() << "Trade::BlobImporter: invalid entry" << i;
+            close();
+            return false;
+        }
+
+        /* Check enum values upfront so the accessors can use them directly.
+           Entries too short for the header are reported by the accessors. */
+        const char* const data = _data + entry.offset;
+        if(((entry.type == BlobEntryType::Mesh2D || entry.type == BlobEntryType::Mesh3D) && entry.size >= sizeof(BlobMesh) &&
+            !isValidPrimitive(reinterpret_cast<const BlobMesh*>(data)->primitive)) ||
+           (entry.type == BlobEntryType::Object3D && entry.size >= sizeof(BlobObject3D) &&
+            reinterpret_cast<const BlobObject3D*>(data)->instanceType > UnsignedInt(ObjectData3D::InstanceType::Empty))) {
+            Error() << "Trade::BlobImporter: invalid entry" << i;
+            close();
+            return false;
+        }
+
+        _entries[UnsignedInt(entry.type)].push_back(&entry);
+    }
+
+    return true;
+}
+
+void BlobImporter::close() {
+    #ifdef MAGNUM_BLOBIMPORTER_USE_MMAP
+    if(_mapped) munmap(const_cast<char*>(_data), _size);
+    #endif
+
+    _data = nullptr;
+    _size = 0;
+    _mapped = false;
+    _filename.clear();
+    _copy.clear();
+    for(auto& entries: _entries) entries.clear();
+
+    AbstractImporter::close();
+}
+
+Int BlobImporter::defaultScene() {
+    return _data ? reinterpret_cast<const BlobHeader*>(_data)->defaultScene : -1;
+}
+
+std::string BlobImporter::name(const UnsignedInt type, const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _entries[type].size(), "Trade::BlobImporter: ID" << id << "out of range", {});
+    const BlobEntry& entry = *_entries[type][id];
+    return std::string(_data + entry.nameOffset, entry.nameSize);
+}
+
+const char* BlobImporter::payload(const UnsignedInt type, const UnsignedInt id, const std::size_t minimalSize) const {
+    CORRADE_ASSERT(id < _entries[type].size(), "Trade::BlobImporter: ID" << id << "out of range", nullptr);
+    const BlobEntry& entry = *_entries[type][id];
+    if(entry.size < minimalSize) {
+        Error() << "Trade::BlobImporter: entry" << id << "is too short";
+        return nullptr;
+    }
+
+    return _data + entry.offset;
+}
+
+const char* BlobImporter::meshPayload(const UnsignedInt type, const UnsignedInt id, const std::size_t vertexSize, const char* const function) const {
+    const char* data = payload(type, id, sizeof(BlobMesh));
+    if(!data) return nullptr;
+
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(data);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount;
+    const std::size_t size = _entries[type][id]->size;
+    if(header.indexed > 1 || (type == UnsignedInt(BlobEntryType::Mesh2D) && header.normalArrayCount) || arrayCount > (size - sizeof(BlobMesh))/sizeof(UnsignedInt) || size < meshSize(data, vertexSize)) {
+        Error() << "Trade::BlobImporter::" + std::string(function) + "(): entry" << id << "is invalid";
+        return nullptr;
+    }
+
+    return data;
+}
+
+bool BlobImporter::read(std::istream* const file, const std::size_t offset, const std::size_t size, char* const out) const {
+    if(!size) return true;
+
+    if(!file) {
+        std::memcpy(out, _data + offset, size);
+        return true;
+    }
+
+    file->seekg(offset);
+    file->read(out, size);
+    if(!file->good()) {
+        Error() << "Trade::BlobImporter: cannot read file" << _filename;
+        return false;
+    }
+
+    return true;
+}
+
+UnsignedInt BlobImporter::sceneCount() const { return _entries[UnsignedInt(BlobEntryType::Scene)].size(); }
+std::string BlobImporter::sceneName(const UnsignedInt id) { return name(UnsignedInt(BlobEntryType::Scene), id); }
+
+SceneData* BlobImporter::scene(const UnsignedInt id) {
+    const char* data = payload(UnsignedInt(BlobEntryType::Scene), id, sizeof(BlobScene));
+    if(!data) return nullptr;
+
+    const BlobScene& header = *reinterpret_cast<const BlobScene*>(data);
+    if(_entries[UnsignedInt(BlobEntryType::Scene)][id]->size < sizeof(BlobScene) + (std::size_t(header.children2DCount) + header.children3DCount)*sizeof(UnsignedInt)) {
+        Error() << "Trade::BlobImporter::scene(): entry" << id << "is too short";
+        return nullptr;
+    }
+
+    const UnsignedInt* children2D = reinterpret_cast<const UnsignedInt*>(data + sizeof(BlobScene));
+    const UnsignedInt* children3D = children2D + header.children2DCount;
+    return new SceneData({children2D, children3D}, {children3D, children3D + header.children3DCount});
+}
+
+UnsignedInt BlobImporter::object3DCount() const { return _entries[UnsignedInt(BlobEntryType::Object3D)].size(); }
+std::string BlobImporter::object3DName(const UnsignedInt id) { return name(UnsignedInt(BlobEntryType::Object3D), id); }
+
+ObjectData3D* BlobImporter::object3D(const UnsignedInt id) {
+    const char* data = payload(UnsignedInt(BlobEntryType::Object3D), id, sizeof(BlobObject3D));
+    if(!data) return nullptr;
+
+    const BlobObject3D& header = *reinterpret_cast<const BlobObject3D*>(data);
+    if(_entries[UnsignedInt(BlobEntryType::Object3D)][id]->size < sizeof(BlobObject3D) + header.childrenCount*sizeof(UnsignedInt)) {
+        Error() << "Trade::BlobImporter::object3D(): entry" << id << "is too short";
+        return nullptr;
+    }
+
+    const UnsignedInt* children = reinterpret_cast<const UnsignedInt*>(data + sizeof(BlobObject3D));
+    const Matrix4 transformation = Matrix4::from(header.transformation);
+    const auto instanceType = ObjectData3D::InstanceType(header.instanceType);
+    if(instanceType == ObjectData3D::InstanceType::Mesh)
+        return new MeshObjectData3D({children, children + header.childrenCount}, transformation, header.instanceId, header.material);
+    if(instanceType == ObjectData3D::InstanceType::Empty)
+        return new ObjectData3D({children, children + header.childrenCount}, transformation);
+    return new ObjectData3D({children, children + header.childrenCount}, transformation, instanceType, header.instanceId);
+}
+
+UnsignedInt BlobImporter::mesh2DCount() const { return _entries[UnsignedInt(BlobEntryType::Mesh2D)].size(); }
+std::string BlobImporter::mesh2DName(const UnsignedInt id) { return name(UnsignedInt(BlobEntryType::Mesh2D), id); }
+
+MeshData2D* BlobImporter::mesh2D(const UnsignedInt id) {
+    const char* data = meshPayload(UnsignedInt(BlobEntryType::Mesh2D), id, sizeof(Vector2), "mesh2D");
+    if(!data) return nullptr;
+
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(data);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.textureCoords2DArrayCount;
+
+    ArrayReader reader(data, arrayCount);
+    std::vector<UnsignedInt>* indices = header.indexed ? reader.next<UnsignedInt>() : nullptr;
+    std::vector<std::vector<Vector2>*> positions = reader.next<Vector2>(header.positionArrayCount);
+    return new MeshData2D(Mesh::Primitive(header.primitive), indices, std::move(positions), reader.next<Vector2>(header.textureCoords2DArrayCount));
+}
+
+MeshDataView2D* BlobImporter::mesh2DView(const UnsignedInt id) {
+    const char* data = meshPayload(UnsignedInt(BlobEntryType::Mesh2D), id, sizeof(Vector2), "mesh2DView");
+    if(!data) return nullptr;
+
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(data);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.textureCoords2DArrayCount;
+
+    ArrayReader reader(data, arrayCount);
+    StridedArrayView<UnsignedInt> indices = header.indexed ? reader.nextView<UnsignedInt>() : StridedArrayView<UnsignedInt>();
+    std::vector<StridedArrayView<Vector2>> positions = reader.nextView<Vector2>(header.positionArrayCount);
+    return new MeshDataView2D(Mesh::Primitive(header.primitive), indices, std::move(positions), reader.nextView<Vector2>(header.textureCoords2DArrayCount));
+}
+
+UnsignedInt BlobImporter::mesh3DCount() const { return _entries[UnsignedInt(BlobEntryType::Mesh3D)].size(); }
+std::string BlobImporter::mesh3DName(const UnsignedInt id) { return name(UnsignedInt(BlobEntryType::Mesh3D), id); }
+
+MeshData3D* BlobImporter::mesh3D(const UnsignedInt id) {
+    const char* data = meshPayload(UnsignedInt(BlobEntryType::Mesh3D), id, sizeof(Vector3), "mesh3D");
+    if(!data) return nullptr;
+
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(data);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount;
+
+    ArrayReader reader(data, arrayCount);
+    std::vector<UnsignedInt>* indices = header.indexed ? reader.next<UnsignedInt>() : nullptr;
+    std::vector<std::vector<Vector3>*> positions = reader.next<Vector3>(header.positionArrayCount);
+    std::vector<std::vector<Vector3>*> normals = reader.next<Vector3>(header.normalArrayCount);
+    return new MeshData3D(Mesh::Primitive(header.primitive), indices, std::move(positions), std::move(normals), reader.next<Vector2>(header.textureCoords2DArrayCount));
+}
+
+MeshDataView3D* BlobImporter::mesh3DView(const UnsignedInt id) {
+    const char* data = meshPayload(UnsignedInt(BlobEntryType::Mesh3D), id, sizeof(Vector3), "mesh3DView");
+    if(!data) return nullptr;
+
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(data);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount;
+
+    ArrayReader reader(data, arrayCount);
+    StridedArrayView<UnsignedInt> indices = header.indexed ? reader.nextView<UnsignedInt>() : StridedArrayView<UnsignedInt>();
+    std::vector<StridedArrayView<Vector3>> positions = reader.nextView<Vector3>(header.positionArrayCount);
+    std::vector<StridedArrayView<Vector3>> normals = reader.nextView<Vector3>(header.normalArrayCount);
+    return new MeshDataView3D(Mesh::Primitive(header.primitive), indices, std::move(positions), std::move(normals), reader.nextView<Vector2>(header.textureCoords2DArrayCount));
+}
+
+bool BlobImporter::streamMesh3D(const UnsignedInt id, const std::size_t chunkSize, const Mesh3DChunkCallback& callback) {
+    const char* data = meshPayload(UnsignedInt(BlobEntryType::Mesh3D), id, sizeof(Vector3), "streamMesh3D");
+    if(!data) return false;
+
+    const BlobMesh& header = *reinterpret_cast<const BlobMesh*>(data);
+    const std::size_t arrayCount = header.indexed + header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount;
+    const UnsignedInt* sizes = reinterpret_cast<const UnsignedInt*>(data + sizeof(BlobMesh));
+
+    /* Offset of each array in the file, element size and vertex count */
+    std::vector<std::size_t> offsets(arrayCount);
+    std::vector<std::size_t> elementSizes(arrayCount);
+    std::size_t offset = _entries[UnsignedInt(BlobEntryType::Mesh3D)][id]->offset + blobAlign(sizeof(BlobMesh) + arrayCount*sizeof(UnsignedInt));
+    std::size_t vertexCount = 0;
+    std::size_t vertexSize = 0;
+    for(std::size_t i = 0; i != arrayCount; ++i) {
+        const bool isIndexArray = header.indexed && i == 0;
+        elementSizes[i] = isIndexArray ? sizeof(UnsignedInt) : i >= arrayCount - header.textureCoords2DArrayCount ? sizeof(Vector2) : sizeof(Vector3);
+        offsets[i] = offset;
+        offset += blobAlign(sizes[i]*elementSizes[i]);
+        if(isIndexArray) continue;
+        vertexCount = std::max<std::size_t>(vertexCount, sizes[i]);
+        vertexSize += elementSizes[i];
+    }
+
+    /* Chunk buffer big enough for either vertex or index chunk, each chunk
+       has at least one element */
+    const std::size_t vertexChunkCount = vertexSize ? std::max<std::size_t>(chunkSize/vertexSize, 1) : 0;
+    const std::size_t indexChunkCount = std::max<std::size_t>(chunkSize/sizeof(UnsignedInt), 1);
+    std::vector<char> buffer(std::max(vertexChunkCount*vertexSize, header.indexed ? indexChunkCount*sizeof(UnsignedInt) : 0));
+
+    std::ifstream file;
+    if(!_filename.empty()) {
+        file.open(_filename, std::ifstream::binary);
+        if(!file.good()) {
+            Error() << "Trade::BlobImporter::streamMesh3D(): cannot open file" << _filename;
+            return false;
+        }
+    }
+    std::istream* const source = _filename.empty() ? nullptr : &file;
+
+    /* Vertex chunks, the same vertex range from all attribute arrays */
+    const std::size_t firstVertexArray = header.indexed ? 1 : 0;
+    std::vector<StridedArrayView<Vector3>> positions(header.positionArrayCount);
+    std::vector<StridedArrayView<Vector3>> normals(header.normalArrayCount);
+    std::vector<StridedArrayView<Vector2>> textureCoords2D(header.textureCoords2DArrayCount);
+    for(std::size_t vertexOffset = 0; vertexOffset < vertexCount; vertexOffset += vertexChunkCount) {
+        char* out = buffer.data();
+        for(std::size_t i = firstVertexArray; i != arrayCount; ++i) {
+            const std::size_t count = std::min<std::size_t>(sizes[i] > vertexOffset ? sizes[i] - vertexOffset : 0, vertexChunkCount);
+            if(!read(source, offsets[i] + vertexOffset*elementSizes[i], count*elementSizes[i], out))
+                return false;
+
+            const std::size_t array = i - firstVertexArray;
+            if(array < header.positionArrayCount)
+                positions[array] = StridedArrayView<Vector3>(reinterpret_cast<Vector3*>(out), count);
+            else if(array < header.positionArrayCount + header.normalArrayCount)
+                normals[array - header.positionArrayCount] = StridedArrayView<Vector3>(reinterpret_cast<Vector3*>(out), count);
+            else
+                textureCoords2D[array - header.positionArrayCount - header.normalArrayCount] = StridedArrayView<Vector2>(reinterpret_cast<Vector2*>(out), count);
+            out += count*elementSizes[i];
+        }
+
+        if(!callback(MeshDataView3D(Mesh::Primitive(header.primitive), {}, positions, normals, textureCoords2D), vertexOffset))
+            return false;
+    }
+
+    /* Index chunks, vertex arrays are empty */
+    if(header.indexed) {
+        for(auto& view: positions) view = {};
+        for(auto& view: normals) view = {};
+        for(auto& view: textureCoords2D) view = {};
+
+        for(std::size_t indexOffset = 0; indexOffset < sizes[0]; indexOffset += indexChunkCount) {
+            const std::size_t count = std::min<std::size_t>(sizes[0] - indexOffset, indexChunkCount);
+            if(!read(source, offsets[0] + indexOffset*sizeof(UnsignedInt), count*sizeof(UnsignedInt), buffer.data()))
+                return false;
+
+            if(!callback(MeshDataView3D(Mesh::Primitive(header.primitive), StridedArrayView<UnsignedInt>(reinterpret_cast<UnsignedInt*>(buffer.data()), count), positions, normals, textureCoords2D), indexOffset))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+UnsignedInt BlobImporter::image2DCount() const { return _entries[UnsignedInt(BlobEntryType::Image2D)].size(); }
+std::string BlobImporter::image2DName(const UnsignedInt id) { return name(UnsignedInt(BlobEntryType::Image2D), id); }
+
+ImageData2D* BlobImporter::image2D(const UnsignedInt id) {
+    const char* data = payload(UnsignedInt(BlobEntryType::Image2D), id, sizeof(BlobImage2D));
+    if(!data) return nullptr;
+
+    const BlobImage2D& header = *reinterpret_cast<const BlobImage2D*>(data);
+    if(!isValidImage(header, _entries[UnsignedInt(BlobEntryType::Image2D)][id]->size)) {
+        Error() << "Trade::BlobImporter::image2D(): entry" << id << "is invalid";
+        return nullptr;
+    }
+
+    unsigned char* pixels = new unsigned char[header.dataSize];
+    std::memcpy(pixels, data + sizeof(BlobImage2D), header.dataSize);
+    return new ImageData2D({header.size[0], header.size[1]}, AbstractImage::Format(header.format), AbstractImage::Type(header.type), pixels);
+}
+
+ImageWrapper2D* BlobImporter::image2DView(const UnsignedInt id) {
+    const char* data = payload(UnsignedInt(BlobEntryType::Image2D), id, sizeof(BlobImage2D));
+    if(!data) return nullptr;
+
+    const BlobImage2D& header = *reinterpret_cast<const BlobImage2D*>(data);
+    if(!isValidImage(header, _entries[UnsignedInt(BlobEntryType::Image2D)][id]->size)) {
+        Error() << "Trade::BlobImporter::image2DView(): entry" << id << "is invalid";
+        return nullptr;
+    }
+
+    /* Writable for the same reason as mesh views, see ArrayReader */
+    return new ImageWrapper2D({header.size[0], header.size[1]}, AbstractImage::Format(header.format), AbstractImage::Type(header.type), const_cast<char*>(data + sizeof(BlobImage2D)));
+}
+
+bool BlobImporter::streamImage2D(const UnsignedInt id, const std::size_t chunkSize, const Image2DChunkCallback& callback) {
+    const char* data = payload(UnsignedInt(BlobEntryType::Image2D), id, sizeof(BlobImage2D));
+    if(!data) return false;
+
+    const BlobImage2D& header = *reinterpret_cast<const BlobImage2D*>(data);
+    if(!isValidImage(header, _entries[UnsignedInt(BlobEntryType::Image2D)][id]->size)) {
+        Error() << "Trade::BlobImporter::streamImage2D(): entry" << id << "is invalid";
+        return false;
+    }
+    if(!header.size[1]) return true;
+
+    /* Chunks are made of whole rows, at least one row per chunk */
+    const std::size_t rowSize = header.dataSize/header.size[1];
+    const Int chunkRowCount = rowSize ? std::min<std::size_t>(std::max<std::size_t>(chunkSize/rowSize, 1), header.size[1]) : header.size[1];
+    std::vector<char> buffer(chunkRowCount*rowSize);
+
+    std::ifstream file;
+    if(!_filename.empty()) {
+        file.open(_filename, std::ifstream::binary);
+        if(!file.good()) {
+            Error() << "Trade::BlobImporter::streamImage2D(): cannot open file" << _filename;
+            return false;
+        }
+    }
+    std::istream* const source = _filename.empty() ? nullptr : &file;
+
+    const std::size_t offset = _entries[UnsignedInt(BlobEntryType::Image2D)][id]->offset + sizeof(BlobImage2D);
+    for(Int row = 0; row < header.size[1]; row += chunkRowCount) {
+        const Int rowCount = std::min(chunkRowCount, header.size[1] - row);
+        if(!read(source, offset + row*rowSize, rowCount*rowSize, buffer.data()))
+            return false;
+
+        if(!callback(ImageWrapper2D({header.size[0], rowCount}, AbstractImage::Format(header.format), AbstractImage::Type(header.type), buffer.data()), row))
+            return false;
+    }
+
+    return true;
+}
+
+}}
@@ -0,0 +1,151 @@
+#ifndef Magnum_Trade_BlobImporter_h
+#define Magnum_Trade_BlobImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Trade::BlobImporter
+ */
+
+#include <iosfwd>
+#include <vector>
+
+#include "Trade/AbstractImporter.h"
+
+namespace Magnum { namespace Trade {
+
+namespace Implementation {
+    struct BlobEntry;
+}
+
+/**
+@brief Importer for Magnum blob format
+
+Imports files created with BlobConverter. Scenes, three-dimensional objects,
+two- and three-dimensional meshes and two-dimensional images are supported,
+together with their names.
+
+Unlike other importers this one is not a plugin, it can be instantiated
+directly. Opening the file only validates the header and entry table, files
+opened with openFile() are memory-mapped where supported, so opening is fast
+regardless of file size. Data passed to openData() are not copied either,
+they must be kept alive until the file is closed. Data accessors then copy the
+arrays directly out of the file without any parsing. Meshes and images can be
+also accessed without any copy using mesh2DView(), mesh3DView() and
+image2DView().
+
+Three-dimensional meshes and two-dimensional images can be also streamed
+using streamMesh3D() and streamImage2D(). For memory-mapped files the chunks
+are read from the file into one reused buffer instead of touching the mapping,
+so the memory usage is bounded by chunk size and doesn't depend on size of the
+file.
+@see BlobConverter
+*/
+class MAGNUM_EXPORT BlobImporter: public AbstractImporter {
+    public:
+        explicit BlobImporter();
+
+        ~BlobImporter();
+
+        Features features() const override;
+
+        void close() override;
+
+        Int defaultScene() override;
+
+        UnsignedInt sceneCount() const override;
+        std::string sceneName(UnsignedInt id) override;
+        SceneData* scene(UnsignedInt id) override;
+
+        UnsignedInt object3DCount() const override;
+        std::string object3DName(UnsignedInt id) override;
+        ObjectData3D* object3D(UnsignedInt id) override;
+
+        UnsignedInt mesh2DCount() const override;
+        std::string mesh2DName(UnsignedInt id) override;
+        MeshData2D* mesh2D(UnsignedInt id) override;
+
+        /**
+         * @brief Two-dimensional mesh view
+         * @param id        %Mesh ID, from range [0, mesh2DCount()).
+         *
+         * Same as mesh3DView(), but for two-dimensional meshes.
+         */
+        MeshDataView2D* mesh2DView(UnsignedInt id);
+
+        UnsignedInt mesh3DCount() const override;
+        std::string mesh3DName(UnsignedInt id) override;
+        MeshData3D* mesh3D(UnsignedInt id) override;
+        bool streamMesh3D(UnsignedInt id, std::size_t chunkSize, const Mesh3DChunkCallback& callback) override;
+
+        /**
+         * @brief Three-dimensional mesh view
+         * @param id        %Mesh ID, from range [0, mesh3DCount()).
+         *
+         * Unlike mesh3D() the arrays are not copied, the returned view
+         * points directly into opened data (i.e. into the mapping for files
+         * opened with openFile() or into memory passed to openData()), so
+         * it is valid only until the file is closed. Modifying the data
+         * through the view doesn't change the file, but changes the memory
+         * passed to openData(). Returns `nullptr` if the entry is invalid.
+         * Deleting the returned object is user responsibility.
+         */
+        MeshDataView3D* mesh3DView(UnsignedInt id);
+
+        UnsignedInt image2DCount() const override;
+        std::string image2DName(UnsignedInt id) override;
+        ImageData2D* image2D(UnsignedInt id) override;
+
+        /**
+         * @brief Two-dimensional image view
+         * @param id        %Image ID, from range [0, image2DCount()).
+         *
+         * Unlike image2D() the pixel data are not copied, the returned
+         * wrapper points directly into opened data. The same lifetime and
+         * modification rules as for mesh3DView() apply.
+         */
+        ImageWrapper2D* image2DView(UnsignedInt id);
+        bool streamImage2D(UnsignedInt id, std::size_t chunkSize, const Image2DChunkCallback& callback) override;
+
+    private:
+        bool doOpenData(const void* data, std::size_t size) override;
+        bool doOpenFile(const std::string& filename) override;
+
+        bool openInternal();
+        std::string name(UnsignedInt type, UnsignedInt id) const;
+        const char* payload(UnsignedInt type, UnsignedInt id, std::size_t minimalSize) const;
+        const char* meshPayload(UnsignedInt type, UnsignedInt id, std::size_t vertexSize, const char* function) const;
+        bool read(std::istream* file, std::size_t offset, std::size_t size, char* out) const;
+
+        const char* _data;
+        std::size_t _size;
+        bool _mapped;
+        std::string _filename;
+        std::vector<char> _copy;
+        std::vector<const Implementation::BlobEntry*> _entries[5];
+};
+
+}}
+
+#endif
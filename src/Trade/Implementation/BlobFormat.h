@@ -0,0 +1,120 @@
+#ifndef Magnum_Trade_Implementation_BlobFormat_h
+#define Magnum_Trade_Implementation_BlobFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Types.h"
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/*
+Layout of the blob file. All values are in native byte order, the endianness
+field is used to detect mismatch. Everything is aligned to BlobAlignment bytes
+so the data can be accessed directly from mapped memory.
+
+    BlobHeader
+    BlobEntry[entryCount]
+    entry names, entry payloads
+
+Entries of the same type are numbered in order in which they appear in the
+file. Payload of each entry type is described below.
+*/
+
+enum: std::size_t { BlobAlignment = 8 };
+
+enum: UnsignedShort {
+    BlobVersion = 1,
+    BlobEndianness = 0x0102
+};
+
+enum class BlobEntryType: UnsignedInt {
+    Scene,
+    Object3D,
+    Mesh2D,
+    Mesh3D,
+    Image2D
+};
+
+enum: UnsignedInt { BlobEntryTypeCount = 5 };
+
+struct BlobHeader {
+    char magic[4];              /* "MGBL" */
+    UnsignedShort version;      /* BlobVersion */
+    UnsignedShort endianness;   /* BlobEndianness */
+    UnsignedInt entryCount;
+    Int defaultScene;
+};
+
+struct BlobEntry {
+    BlobEntryType type;
+    UnsignedInt nameSize;
+    UnsignedLong nameOffset;
+    UnsignedLong offset;
+    UnsignedLong size;
+};
+
+/* Scene: header, then 2D children, then 3D children */
+struct BlobScene {
+    UnsignedInt children2DCount;
+    UnsignedInt children3DCount;
+};
+
+/* Object: header, then children. Material is used only for mesh instances. */
+struct BlobObject3D {
+    Float transformation[16];
+    UnsignedInt instanceType;
+    Int instanceId;
+    UnsignedInt material;
+    UnsignedInt childrenCount;
+};
+
+/* Mesh: header, then UnsignedInt size of each array, then the arrays in order
+   indices (if indexed), positions, normals (3D only), texture coordinates,
+   each aligned to BlobAlignment */
+struct BlobMesh {
+    UnsignedInt primitive;
+    UnsignedInt indexed;
+    UnsignedInt positionArrayCount;
+    UnsignedInt normalArrayCount;
+    UnsignedInt textureCoords2DArrayCount;
+    UnsignedInt reserved;
+};
+
+/* Image: header, then pixel data */
+struct BlobImage2D {
+    Int size[2];
+    UnsignedInt format;
+    UnsignedInt type;
+    UnsignedLong dataSize;
+};
+
+inline constexpr std::size_t blobAlign(std::size_t offset) {
+    return (offset + BlobAlignment - 1)/BlobAlignment*BlobAlignment;
+}
+
+static_assert(sizeof(BlobHeader) == 16 && sizeof(BlobEntry) == 32 && sizeof(BlobObject3D) == 80 && sizeof(BlobMesh) == 24 && sizeof(BlobImage2D) == 24, "Improper size of blob format structures");
+
+}}}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef Magnum_Trade_Implementation_MeshDataView_h
+#define Magnum_Trade_Implementation_MeshDataView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <vector>
+
+#include "StridedArrayView.h"
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Helpers shared by MeshDataView2D and MeshDataView3D */
+
+template<class T> inline StridedArrayView<char> typeErase(StridedArrayView<T> view) {
+    return StridedArrayView<char>(reinterpret_cast<char*>(view.data()), view.size(), view.stride());
+}
+
+template<class T> inline void appendAttributes(std::vector<StridedArrayView<char>>& attributes, const std::vector<StridedArrayView<T>>& views) {
+    for(StridedArrayView<T> view: views) attributes.push_back(typeErase(view));
+}
+
+/* Size of all arrays in bytes, null array pointers are treated as empty */
+template<class T> inline std::size_t arraySize(const std::vector<T>* array) {
+    return array ? array->size()*sizeof(T) : 0;
+}
+
+/* Copy the array to given position in the buffer, return view on the copy
+   and advance the position. All attribute types are made of 32bit values, so
+   everything is properly aligned without any padding. */
+template<class T> StridedArrayView<char> pack(char*& position, const std::vector<T>* array) {
+    if(!array || array->empty()) return StridedArrayView<char>();
+
+    std::memcpy(position, array->data(), array->size()*sizeof(T));
+    StridedArrayView<char> view(position, array->size(), sizeof(T));
+    position += array->size()*sizeof(T);
+    return view;
+}
+
+}}}
+
+#endif
@@ -39,7 +39,7 @@ namespace Magnum { namespace Trade {
 
 Provides access to mesh data and additional information, such as primitive
 type.
-@see MeshData3D
+@see MeshData3D, MeshDataView2D
 */
 class MAGNUM_EXPORT MeshData2D {
     MeshData2D(const MeshData2D&) = delete;
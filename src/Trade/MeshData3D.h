@@ -39,7 +39,7 @@ namespace Magnum { namespace Trade {
 
 Provides access to mesh data and additional information, such as primitive
 type.
-@see MeshData2D
+@see MeshData2D, MeshDataView3D
 */
 class MAGNUM_EXPORT MeshData3D {
     MeshData3D(const MeshData3D&) = delete;
@@ -0,0 +1,104 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshDataView3D.h"
+
+#include "Math/Vector3.h"
+#include "Trade/MeshData3D.h"
+#include "Trade/Implementation/MeshDataView.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+std::vector<StridedArrayView<char>> attributes(StridedArrayView<UnsignedInt> indices, const std::vector<StridedArrayView<Vector3>>& positions, const std::vector<StridedArrayView<Vector3>>& normals, const std::vector<StridedArrayView<Vector2>>& textureCoords2D) {
+    std::vector<StridedArrayView<char>> attributes;
+    attributes.reserve(1 + positions.size() + normals.size() + textureCoords2D.size());
+    attributes.push_back(Implementation::typeErase(indices));
+    Implementation::appendAttributes(attributes, positions);
+    Implementation::appendAttributes(attributes, normals);
+    Implementation::appendAttributes(attributes, textureCoords2D);
+    return attributes;
+}
+
+}
+
+MeshDataView3D::MeshDataView3D(Mesh::Primitive primitive, StridedArrayView<UnsignedInt> indices, std::vector<StridedArrayView<Vector3>> positions, std::vector<StridedArrayView<Vector3>> normals, std::vector<StridedArrayView<Vector2>> textureCoords2D): _primitive(primitive), _positionArrayCount(positions.size()), _normalArrayCount(normals.size()), _attributes(attributes(indices, positions, normals, textureCoords2D)) {}
+
+MeshDataView3D::MeshDataView3D(std::vector<char> buffer, Mesh::Primitive primitive, StridedArrayView<UnsignedInt> indices, std::vector<StridedArrayView<Vector3>> positions, std::vector<StridedArrayView<Vector3>> normals, std::vector<StridedArrayView<Vector2>> textureCoords2D): _buffer(std::move(buffer)), _primitive(primitive), _positionArrayCount(positions.size()), _normalArrayCount(normals.size()), _attributes(attributes(indices, positions, normals, textureCoords2D)) {}
+
+MeshDataView3D::MeshDataView3D(const MeshData3D& data): _primitive(data.primitive()), _positionArrayCount(data.positionArrayCount()), _normalArrayCount(data.normalArrayCount()) {
+    /* Compute total size and allocate everything at once */
+    std::size_t size = Implementation::arraySize(data.indices());
+    for(UnsignedInt i = 0; i != data.positionArrayCount(); ++i)
+        size += Implementation::arraySize(data.positions(i));
+    for(UnsignedInt i = 0; i != data.normalArrayCount(); ++i)
+        size += Implementation::arraySize(data.normals(i));
+    for(UnsignedInt i = 0; i != data.textureCoords2DArrayCount(); ++i)
+        size += Implementation::arraySize(data.textureCoords2D(i));
+    _buffer.resize(size);
+
+    /* Copy the arrays */
+    char* position = _buffer.data();
+    _attributes.reserve(1 + data.positionArrayCount() + data.normalArrayCount() + data.textureCoords2DArrayCount());
+    _attributes.push_back(Implementation::pack(position, data.indices()));
+    for(UnsignedInt i = 0; i != data.positionArrayCount(); ++i)
+        _attributes.push_back(Implementation::pack(position, data.positions(i)));
+    for(UnsignedInt i = 0; i != data.normalArrayCount(); ++i)
+        _attributes.push_back(Implementation::pack(position, data.normals(i)));
+    for(UnsignedInt i = 0; i != data.textureCoords2DArrayCount(); ++i)
+        _attributes.push_back(Implementation::pack(position, data.textureCoords2D(i)));
+}
+
+MeshDataView3D::MeshDataView3D(MeshDataView3D&& other): _buffer(std::move(other._buffer)), _primitive(other._primitive), _positionArrayCount(other._positionArrayCount), _normalArrayCount(other._normalArrayCount), _attributes(std::move(other._attributes)) {}
+
+MeshDataView3D& MeshDataView3D::operator=(MeshDataView3D&& other) {
+    std::swap(_buffer, other._buffer);
+    _primitive = other._primitive;
+    std::swap(_positionArrayCount, other._positionArrayCount);
+    std::swap(_normalArrayCount, other._normalArrayCount);
+    std::swap(_attributes, other._attributes);
+    return *this;
+}
+
+MeshData3D MeshDataView3D::toMeshData() const {
+    std::vector<std::vector<Vector3>*> positions;
+    positions.reserve(_positionArrayCount);
+    for(UnsignedInt i = 0; i != _positionArrayCount; ++i)
+        positions.push_back(new std::vector<Vector3>(this->positions(i).toVector()));
+
+    std::vector<std::vector<Vector3>*> normals;
+    normals.reserve(_normalArrayCount);
+    for(UnsignedInt i = 0; i != _normalArrayCount; ++i)
+        normals.push_back(new std::vector<Vector3>(this->normals(i).toVector()));
+
+    std::vector<std::vector<Vector2>*> textureCoords2D;
+    textureCoords2D.reserve(textureCoords2DArrayCount());
+    for(UnsignedInt i = 0; i != textureCoords2DArrayCount(); ++i)
+        textureCoords2D.push_back(new std::vector<Vector2>(this->textureCoords2D(i).toVector()));
+
+    return MeshData3D(_primitive, isIndexed() ? new std::vector<UnsignedInt>(indices().toVector()) : nullptr, std::move(positions), std::move(normals), std::move(textureCoords2D));
+}
+
+}}
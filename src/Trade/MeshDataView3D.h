@@ -0,0 +1,171 @@
+#ifndef Magnum_Trade_MeshDataView3D_h
+#define Magnum_Trade_MeshDataView3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Trade::MeshDataView3D
+ */
+
+#include <vector>
+
+#include "Mesh.h"
+#include "StridedArrayView.h"
+#include "Trade/Trade.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Three-dimensional mesh data view
+
+Unlike MeshData3D, which stores each attribute in separately allocated
+`std::vector`, this class references all attributes through
+@ref StridedArrayView "strided views". The views can either point into
+external memory (e.g. mapped file or existing interleaved buffer), which the
+caller must keep alive for the whole lifetime of the instance, or into
+single contiguous buffer owned by this class. Converting MeshData3D using
+MeshDataView3D(const MeshData3D&) packs all its arrays into one such
+buffer. The views can be passed directly to MeshTools functions, e.g.:
+@code
+Trade::MeshDataView3D data(Primitives::Cube::solid());
+MeshTools::transformPointsInPlace(transformation, data.positions(0));
+@endcode
+@see MeshDataView2D
+*/
+class MAGNUM_EXPORT MeshDataView3D {
+    MeshDataView3D(const MeshDataView3D&) = delete;
+    MeshDataView3D& operator=(const MeshDataView3D&) = delete;
+
+    public:
+        /**
+         * @brief Construct view on external data
+         * @param primitive         Primitive
+         * @param indices           Indices or empty view, if this is not
+         *      indexed mesh
+         * @param positions         Vertex position arrays. At least one
+         *      position array should be present.
+         * @param normals           Normal arrays or empty array
+         * @param textureCoords2D   Two-dimensional texture coordinate arrays
+         *      or empty array
+         *
+         * The data are not copied, the caller must ensure that they are
+         * alive for whole lifetime of the instance.
+         */
+        explicit MeshDataView3D(Mesh::Primitive primitive, StridedArrayView<UnsignedInt> indices, std::vector<StridedArrayView<Vector3>> positions, std::vector<StridedArrayView<Vector3>> normals, std::vector<StridedArrayView<Vector2>> textureCoords2D);
+
+        /**
+         * @brief Construct view on owned buffer
+         *
+         * Same as above, but takes ownership of @p buffer, into which all
+         * the views are expected to point.
+         */
+        explicit MeshDataView3D(std::vector<char> buffer, Mesh::Primitive primitive, StridedArrayView<UnsignedInt> indices, std::vector<StridedArrayView<Vector3>> positions, std::vector<StridedArrayView<Vector3>> normals, std::vector<StridedArrayView<Vector2>> textureCoords2D);
+
+        /**
+         * @brief Construct from MeshData3D
+         *
+         * Copies all arrays of @p data into one contiguous owned buffer.
+         */
+        explicit MeshDataView3D(const MeshData3D& data);
+
+        /** @brief Move constructor */
+        MeshDataView3D(MeshDataView3D&& other);
+
+        /** @brief Move assignment */
+        MeshDataView3D& operator=(MeshDataView3D&& other);
+
+        /** @brief Primitive */
+        inline Mesh::Primitive primitive() const { return _primitive; }
+
+        /**
+         * @brief Owned buffer
+         *
+         * Empty if the instance references external data.
+         */
+        inline const std::vector<char>& buffer() const { return _buffer; }
+
+        /** @brief Whether the mesh is indexed */
+        inline bool isIndexed() const { return !_attributes[0].empty(); }
+
+        /**
+         * @brief Indices
+         * @return Indices or empty view if the mesh is not indexed.
+         */
+        inline StridedArrayView<UnsignedInt> indices() { return attribute<UnsignedInt>(0); }
+        inline StridedArrayView<const UnsignedInt> indices() const { return attribute<const UnsignedInt>(0); } /**< @overload */
+
+        /** @brief Count of vertex position arrays */
+        inline UnsignedInt positionArrayCount() const { return _positionArrayCount; }
+
+        /**
+         * @brief Positions
+         * @param id    ID of position data array
+         */
+        inline StridedArrayView<Vector3> positions(UnsignedInt id) { return attribute<Vector3>(1 + id); }
+        inline StridedArrayView<const Vector3> positions(UnsignedInt id) const { return attribute<const Vector3>(1 + id); } /**< @overload */
+
+        /** @brief Count of normal arrays */
+        inline UnsignedInt normalArrayCount() const { return _normalArrayCount; }
+
+        /**
+         * @brief Normals
+         * @param id    ID of normal data array
+         */
+        inline StridedArrayView<Vector3> normals(UnsignedInt id) { return attribute<Vector3>(1 + _positionArrayCount + id); }
+        inline StridedArrayView<const Vector3> normals(UnsignedInt id) const { return attribute<const Vector3>(1 + _positionArrayCount + id); } /**< @overload */
+
+        /** @brief Count of 2D texture coordinate arrays */
+        inline UnsignedInt textureCoords2DArrayCount() const { return _attributes.size() - (1 + _positionArrayCount + _normalArrayCount); }
+
+        /**
+         * @brief 2D texture coordinates
+         * @param id    ID of texture coordinates array
+         */
+        inline StridedArrayView<Vector2> textureCoords2D(UnsignedInt id) { return attribute<Vector2>(1 + _positionArrayCount + _normalArrayCount + id); }
+        inline StridedArrayView<const Vector2> textureCoords2D(UnsignedInt id) const { return attribute<const Vector2>(1 + _positionArrayCount + _normalArrayCount + id); } /**< @overload */
+
+        /**
+         * @brief Copy the data to MeshData3D
+         *
+         * Useful for passing the data to APIs which don't operate on views.
+         */
+        MeshData3D toMeshData() const;
+
+    private:
+        /* All views are stored type-erased in one array to avoid allocation
+           per attribute kind, index view is always first */
+        template<class T> inline StridedArrayView<T> attribute(std::size_t i) const {
+            return StridedArrayView<T>(reinterpret_cast<T*>(_attributes[i].data()), _attributes[i].size(), _attributes[i].stride());
+        }
+
+        std::vector<char> _buffer;
+        Mesh::Primitive _primitive;
+        UnsignedInt _positionArrayCount;
+        UnsignedInt _normalArrayCount;
+        std::vector<StridedArrayView<char>> _attributes;
+};
+
+}}
+
+#endif
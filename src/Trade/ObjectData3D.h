@@ -78,6 +78,7 @@ class MAGNUM_EXPORT ObjectData3D {
 
         /** @brief Child objects */
         inline std::vector<UnsignedInt>& children() { return _children; }
+        inline const std::vector<UnsignedInt>& children() const { return _children; } /**< @overload */
 
         /** @brief Transformation (relative to parent) */
         inline Matrix4 transformation() const { return _transformation; }
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Trade/AbstractImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class AbstractImporterTest: public Corrade::TestSuite::Tester {
+    public:
+        AbstractImporterTest();
+
+        void forName();
+        void forNameEmptyDuplicate();
+        void forNameClose();
+        void forNameReopenWithoutClose();
+};
+
+AbstractImporterTest::AbstractImporterTest() {
+    addTests({&AbstractImporterTest::forName,
+              &AbstractImporterTest::forNameEmptyDuplicate,
+              &AbstractImporterTest::forNameClose,
+              &AbstractImporterTest::forNameReopenWithoutClose});
+}
+
+namespace {
+    /* Importer which has "file" as list of mesh names and counts how many
+       times a name was queried */
+    class Importer: public AbstractImporter {
+        public:
+            Importer(): nameQueryCount(0) {}
+
+            Features features() const override { return Feature::OpenFile; }
+
+            bool doOpenFile(const std::string& filename) override {
+                _names.clear();
+                std::istringstream in(filename);
+                for(std::string name; std::getline(in, name, ','); )
+                    _names.push_back(name);
+                return true;
+            }
+
+            /* Intentionally not calling AbstractImporter::close() */
+            void close() override { _names.clear(); }
+
+            UnsignedInt mesh3DCount() const override { return _names.size(); }
+
+            std::string mesh3DName(UnsignedInt id) override {
+                ++nameQueryCount;
+                return _names[id];
+            }
+
+            std::size_t nameQueryCount;
+
+        private:
+            std::vector<std::string> _names;
+    };
+}
+
+void AbstractImporterTest::forName() {
+    Importer importer;
+    importer.openFile("cube,sphere,plane");
+
+    /* First query builds the index */
+    CORRADE_COMPARE(importer.mesh3DForName("sphere"), 1);
+    CORRADE_COMPARE(importer.nameQueryCount, 3);
+
+    /* Subsequent queries don't touch names anymore */
+    CORRADE_COMPARE(importer.mesh3DForName("plane"), 2);
+    CORRADE_COMPARE(importer.mesh3DForName("cube"), 0);
+    CORRADE_COMPARE(importer.mesh3DForName("cone"), -1);
+    CORRADE_COMPARE(importer.nameQueryCount, 3);
+
+    /* Other categories are indexed separately */
+    CORRADE_COMPARE(importer.mesh2DForName("cube"), -1);
+}
+
+void AbstractImporterTest::forNameEmptyDuplicate() {
+    Importer importer;
+    importer.openFile(",cube,,cube,sphere");
+
+    CORRADE_COMPARE(importer.mesh3DForName(""), -1);
+    CORRADE_COMPARE(importer.mesh3DForName("cube"), 1);
+    CORRADE_COMPARE(importer.mesh3DForName("sphere"), 4);
+}
+
+void AbstractImporterTest::forNameClose() {
+    Importer importer;
+    importer.openFile("cube,sphere");
+    CORRADE_COMPARE(importer.mesh3DForName("sphere"), 1);
+
+    /* Same count, different names, the index must be discarded even if
+       the plugin doesn't call AbstractImporter::close() */
+    importer.close();
+    importer.openFile("sphere,cube");
+    CORRADE_COMPARE(importer.mesh3DForName("sphere"), 0);
+    CORRADE_COMPARE(importer.nameQueryCount, 4);
+}
+
+void AbstractImporterTest::forNameReopenWithoutClose() {
+    Importer importer;
+    importer.openFile("cube,sphere");
+    CORRADE_COMPARE(importer.mesh3DForName("plane"), -1);
+
+    /* Changed count */
+    importer.openFile("cube,sphere,plane");
+    CORRADE_COMPARE(importer.mesh3DForName("plane"), 2);
+
+    /* Same count, different names */
+    importer.openFile("plane,cube,sphere");
+    CORRADE_COMPARE(importer.mesh3DForName("plane"), 0);
+    CORRADE_COMPARE(importer.mesh3DForName("sphere"), 2);
+    CORRADE_COMPARE(importer.mesh3DForName("cone"), -1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImporterTest)
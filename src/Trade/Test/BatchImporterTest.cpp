@@ -0,0 +1,201 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <TestSuite/Tester.h>
+
+#include "Math/Vector3.h"
+#include "Trade/BatchImporter.h"
+#include "Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class BatchImporterTest: public Corrade::TestSuite::Tester {
+    public:
+        BatchImporterTest();
+
+        void order();
+        void noThreads();
+        void notFound();
+        void maxInFlight();
+        void destroyPending();
+};
+
+BatchImporterTest::BatchImporterTest() {
+    addTests({&BatchImporterTest::order,
+              &BatchImporterTest::noThreads,
+              &BatchImporterTest::notFound,
+              &BatchImporterTest::maxInFlight,
+              &BatchImporterTest::destroyPending});
+}
+
+namespace {
+    std::atomic<std::size_t> started, taken, maxInFlightCount, openCount;
+
+    /* Importer with 100 meshes in each file except "nonexistent", each
+       containing one vertex with mesh ID and file name length. Importing
+       takes a while so the threads finish out of order. */
+    class Importer: public AbstractImporter {
+        public:
+            Features features() const override { return Feature::OpenFile; }
+
+            bool doOpenFile(const std::string& filename) override {
+                ++openCount;
+                if(filename == "nonexistent") {
+                    Error() << "cannot open" << filename;
+                    return false;
+                }
+
+                _filename = filename;
+                return true;
+            }
+
+            void close() override { _filename.clear(); }
+
+            UnsignedInt mesh3DCount() const override { return _filename.empty() ? 0 : 100; }
+
+            MeshData3D* mesh3D(UnsignedInt id) override {
+                const std::size_t inFlight = ++started - taken;
+                for(std::size_t max = maxInFlightCount; inFlight > max && !maxInFlightCount.compare_exchange_weak(max, inFlight); ) {}
+
+                std::this_thread::sleep_for(std::chrono::microseconds((id*37)%5*100));
+                return new MeshData3D(Mesh::Primitive::Points, nullptr, {new std::vector<Vector3>{Vector3(Float(id), Float(_filename.size()), 0.0f)}}, {}, {});
+            }
+
+        private:
+            std::string _filename;
+    };
+
+    AbstractImporter* factory() { return new Importer; }
+
+    void reset() {
+        started = 0;
+        taken = 0;
+        maxInFlightCount = 0;
+        openCount = 0;
+    }
+}
+
+void BatchImporterTest::order() {
+    reset();
+    BatchImporter<MeshData3D> importer(factory, 4);
+    CORRADE_COMPARE(importer.threadCount(), 4);
+
+    std::vector<UnsignedInt> ids;
+    for(UnsignedInt i = 0; i != 50; ++i) ids.push_back((i*13)%100);
+    importer.add("a", ids);
+    CORRADE_COMPARE(importer.add("bb", 7), 50);
+    CORRADE_COMPARE(importer.pendingCount(), 51);
+
+    /* Results are in order of requests */
+    for(UnsignedInt id: ids) {
+        MeshData3D* data = importer.next();
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(data->positions(0)->front(), Vector3(Float(id), 1.0f, 0.0f));
+        delete data;
+    }
+
+    MeshData3D* data = importer.next();
+    CORRADE_COMPARE(data->positions(0)->front(), Vector3(7.0f, 2.0f, 0.0f));
+    delete data;
+    CORRADE_COMPARE(importer.pendingCount(), 0);
+
+    /* The file is opened only once per thread */
+    CORRADE_VERIFY(openCount <= 8);
+}
+
+void BatchImporterTest::noThreads() {
+    reset();
+    BatchImporter<MeshData3D> importer(factory, 0);
+    CORRADE_COMPARE(importer.threadCount(), 0);
+
+    importer.add("a", {3, 5});
+    CORRADE_COMPARE(std::size_t(started), 0);
+
+    MeshData3D* data = importer.next();
+    CORRADE_COMPARE(data->positions(0)->front(), Vector3(3.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(std::size_t(started), 1);
+    delete data;
+
+    data = importer.next();
+    CORRADE_COMPARE(data->positions(0)->front(), Vector3(5.0f, 1.0f, 0.0f));
+    delete data;
+    CORRADE_COMPARE(std::size_t(openCount), 1);
+}
+
+void BatchImporterTest::notFound() {
+    reset();
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BatchImporter<MeshData3D> importer(factory, 2);
+    importer.add("nonexistent", 0);
+    importer.add("a", 100);
+    importer.add("a", 99);
+
+    CORRADE_VERIFY(!importer.next());
+    CORRADE_VERIFY(!importer.next());
+    MeshData3D* data = importer.next();
+    CORRADE_VERIFY(data);
+    delete data;
+
+    CORRADE_VERIFY(out.str().find("Trade::BatchImporter: mesh3D 100 not found in a\n") != std::string::npos);
+}
+
+void BatchImporterTest::maxInFlight() {
+    reset();
+    BatchImporter<MeshData3D> importer(factory, 4, 2);
+
+    for(UnsignedInt i = 0; i != 40; ++i) importer.add("a", i);
+    for(UnsignedInt i = 0; i != 40; ++i) {
+        MeshData3D* data = importer.next();
+        ++taken;
+        CORRADE_COMPARE(data->positions(0)->front().x(), Float(i));
+        delete data;
+    }
+
+    /* The taken count is incremented only after next() returns, while the
+       worker may start the next job already inside next(), so the importer
+       can observe one item more than the limit */
+    CORRADE_VERIFY(maxInFlightCount <= 3);
+}
+
+void BatchImporterTest::destroyPending() {
+    reset();
+
+    /* Unfinished jobs are discarded, finished results deleted */
+    {
+        BatchImporter<MeshData3D> importer(factory, 2);
+        for(UnsignedInt i = 0; i != 100; ++i) importer.add("a", i);
+        delete importer.next();
+    }
+
+    CORRADE_VERIFY(started < 100);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BatchImporterTest)
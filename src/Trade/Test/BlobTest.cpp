@@ -0,0 +1,703 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <cstdio>
+#include <sstream>
+#include <TestSuite/Tester.h>
+#include <TestSuite/Compare/Container.h>
+
+#include "ImageWrapper.h"
+#include "Math/Vector3.h"
+#include "Trade/BlobConverter.h"
+#include "Trade/BlobImporter.h"
+#include "Trade/ImageData.h"
+#include "Trade/MeshData2D.h"
+#include "Trade/MeshData3D.h"
+#include "Trade/MeshDataView2D.h"
+#include "Trade/MeshDataView3D.h"
+#include "Trade/MeshObjectData3D.h"
+#include "Trade/SceneData.h"
+#include "Trade/Implementation/BlobFormat.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class BlobTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit BlobTest();
+
+        void scene();
+        void object3D();
+        void mesh2D();
+        void mesh2DView();
+        void mesh3D();
+        void mesh3DView();
+        void image2D();
+        void image2DView();
+        void unalignedData();
+        void names();
+        void file();
+        void importer();
+        void invalid();
+        void invalidEntry();
+        void invalidEntryValue();
+        void invalidMesh();
+        void invalidImage();
+
+        void streamMesh3D();
+        void streamMesh3DFile();
+        void streamImage2D();
+        void streamAbort();
+};
+
+BlobTest::BlobTest() {
+    addTests({&BlobTest::scene,
+              &BlobTest::object3D,
+              &BlobTest::mesh2D,
+              &BlobTest::mesh2DView,
+              &BlobTest::mesh3D,
+              &BlobTest::mesh3DView,
+              &BlobTest::image2D,
+              &BlobTest::image2DView,
+              &BlobTest::unalignedData,
+              &BlobTest::names,
+              &BlobTest::file,
+              &BlobTest::importer,
+              &BlobTest::invalid,
+              &BlobTest::invalidEntry,
+              &BlobTest::invalidEntryValue,
+              &BlobTest::invalidMesh,
+              &BlobTest::invalidImage,
+
+              &BlobTest::streamMesh3D,
+              &BlobTest::streamMesh3DFile,
+              &BlobTest::streamImage2D,
+              &BlobTest::streamAbort});
+}
+
+namespace {
+    /* Opens the blob from data returned by the converter, the data are
+       referenced by the importer so they are returned to the caller */
+    bool open(BlobImporter& importer, const BlobConverter& converter, std::vector<char>& data) {
+        data = converter.convertToData();
+        return importer.openData(data.data(), data.size());
+    }
+
+    /* Payload header of first entry */
+    template<class T> T& payload(std::vector<char>& data) {
+        const auto& entry = *reinterpret_cast<const Implementation::BlobEntry*>(data.data() + sizeof(Implementation::BlobHeader));
+        return *reinterpret_cast<T*>(data.data() + entry.offset);
+    }
+
+    /* Mesh with 1000 vertices and 3000 indices */
+    MeshData3D bigMesh() {
+        std::vector<UnsignedInt>* indices = new std::vector<UnsignedInt>(3000);
+        std::vector<Vector3>* positions = new std::vector<Vector3>(1000);
+        std::vector<Vector2>* textureCoords2D = new std::vector<Vector2>(1000);
+        for(UnsignedInt i = 0; i != indices->size(); ++i)
+            (*indices)[i] = (i*7)%1000;
+        for(UnsignedInt i = 0; i != positions->size(); ++i) {
+            (*positions)[i] = Vector3(Float(i), 1.0f, -Float(i));
+            (*textureCoords2D)[i] = Vector2(Float(i)/1000.0f);
+        }
+        return MeshData3D(Mesh::Primitive::Triangles, indices, {positions}, {}, {textureCoords2D});
+    }
+
+    /* Reassembles the mesh from streamed chunks */
+    struct StreamedMesh {
+        bool operator()(const MeshDataView3D& chunk, std::size_t offset) {
+            maxChunkSize = std::max(maxChunkSize, chunk.indices().size()*sizeof(UnsignedInt) + chunk.positions(0).size()*sizeof(Vector3) + chunk.textureCoords2D(0).size()*sizeof(Vector2));
+            ++chunkCount;
+            if(chunk.isIndexed()) {
+                if(offset != indices.size()) return false;
+                indices.insert(indices.end(), chunk.indices().begin(), chunk.indices().end());
+            } else {
+                if(offset != positions.size() || !indices.empty()) return false;
+                positions.insert(positions.end(), chunk.positions(0).begin(), chunk.positions(0).end());
+                textureCoords2D.insert(textureCoords2D.end(), chunk.textureCoords2D(0).begin(), chunk.textureCoords2D(0).end());
+            }
+            return true;
+        }
+
+        std::vector<UnsignedInt> indices;
+        std::vector<Vector3> positions;
+        std::vector<Vector2> textureCoords2D;
+        std::size_t chunkCount = 0, maxChunkSize = 0;
+    };
+}
+
+void BlobTest::scene() {
+    BlobConverter converter;
+    converter.addScene(SceneData({}, {}));
+    converter.addScene(SceneData({3, 1}, {0, 5, 7}));
+    converter.setDefaultScene(1);
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+    CORRADE_COMPARE(importer.sceneCount(), 2);
+    CORRADE_COMPARE(importer.defaultScene(), 1);
+
+    SceneData* scene = importer.scene(1);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->children2D(), (std::vector<UnsignedInt>{3, 1}));
+    CORRADE_COMPARE(scene->children3D(), (std::vector<UnsignedInt>{0, 5, 7}));
+    delete scene;
+}
+
+void BlobTest::object3D() {
+    BlobConverter converter;
+    converter.addObject3D(ObjectData3D({1, 2}, Matrix4::translation({1.0f, 2.0f, 3.0f})));
+    converter.addObject3D(ObjectData3D({}, Matrix4::scaling(Vector3(2.0f)), ObjectData3D::InstanceType::Light, 7));
+    converter.addObject3D(MeshObjectData3D({3}, Matrix4::rotationX(Deg(30.0f)), 4, 5));
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+    CORRADE_COMPARE(importer.object3DCount(), 3);
+
+    ObjectData3D* empty = importer.object3D(0);
+    CORRADE_COMPARE(empty->children(), (std::vector<UnsignedInt>{1, 2}));
+    CORRADE_COMPARE(empty->transformation(), Matrix4::translation({1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(empty->instanceType(), ObjectData3D::InstanceType::Empty);
+    CORRADE_COMPARE(empty->instanceId(), -1);
+
+    ObjectData3D* light = importer.object3D(1);
+    CORRADE_COMPARE(light->instanceType(), ObjectData3D::InstanceType::Light);
+    CORRADE_COMPARE(light->instanceId(), 7);
+
+    ObjectData3D* mesh = importer.object3D(2);
+    CORRADE_COMPARE(mesh->children(), std::vector<UnsignedInt>{3});
+    CORRADE_COMPARE(mesh->transformation(), Matrix4::rotationX(Deg(30.0f)));
+    CORRADE_COMPARE(mesh->instanceType(), ObjectData3D::InstanceType::Mesh);
+    CORRADE_COMPARE(mesh->instanceId(), 4);
+    CORRADE_COMPARE(static_cast<MeshObjectData3D*>(mesh)->material(), 5);
+
+    delete empty;
+    delete light;
+    delete mesh;
+}
+
+void BlobTest::mesh2D() {
+    BlobConverter converter;
+    converter.addMesh2D(MeshData2D(Mesh::Primitive::Lines, nullptr,
+        {new std::vector<Vector2>{{0.0f, 1.0f}, {2.0f, 3.0f}, {4.0f, 5.0f}}}, {}));
+    converter.addMesh2D(MeshData2D(Mesh::Primitive::Triangles,
+        new std::vector<UnsignedInt>{0, 1, 2},
+        {new std::vector<Vector2>{{0.0f, 1.0f}}, new std::vector<Vector2>{{2.0f, 3.0f}}},
+        {new std::vector<Vector2>{{0.5f, 0.5f}}}));
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+    CORRADE_COMPARE(importer.mesh2DCount(), 2);
+
+    MeshData2D* lines = importer.mesh2D(0);
+    CORRADE_COMPARE(lines->primitive(), Mesh::Primitive::Lines);
+    CORRADE_VERIFY(!lines->indices());
+    CORRADE_COMPARE(lines->positionArrayCount(), 1);
+    CORRADE_COMPARE(*lines->positions(0), (std::vector<Vector2>{{0.0f, 1.0f}, {2.0f, 3.0f}, {4.0f, 5.0f}}));
+    CORRADE_COMPARE(lines->textureCoords2DArrayCount(), 0);
+
+    MeshData2D* triangles = importer.mesh2D(1);
+    CORRADE_COMPARE(triangles->primitive(), Mesh::Primitive::Triangles);
+    CORRADE_VERIFY(triangles->indices());
+    CORRADE_COMPARE(*triangles->indices(), (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(triangles->positionArrayCount(), 2);
+    CORRADE_COMPARE(*triangles->positions(1), (std::vector<Vector2>{{2.0f, 3.0f}}));
+    CORRADE_COMPARE(triangles->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(*triangles->textureCoords2D(0), (std::vector<Vector2>{{0.5f, 0.5f}}));
+
+    delete lines;
+    delete triangles;
+}
+
+void BlobTest::mesh2DView() {
+    BlobConverter converter;
+    converter.addMesh2D(MeshData2D(Mesh::Primitive::Triangles,
+        new std::vector<UnsignedInt>{0, 1, 2},
+        {new std::vector<Vector2>{{0.0f, 1.0f}, {2.0f, 3.0f}, {4.0f, 5.0f}}},
+        {new std::vector<Vector2>{{0.5f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}}}));
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+
+    MeshDataView2D* mesh = importer.mesh2DView(0);
+    CORRADE_VERIFY(mesh->buffer().empty());
+    CORRADE_COMPARE(mesh->primitive(), Mesh::Primitive::Triangles);
+    CORRADE_COMPARE((std::vector<UnsignedInt>{mesh->indices().begin(), mesh->indices().end()}), (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE((std::vector<Vector2>{mesh->positions(0).begin(), mesh->positions(0).end()}), (std::vector<Vector2>{{0.0f, 1.0f}, {2.0f, 3.0f}, {4.0f, 5.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE((std::vector<Vector2>{mesh->textureCoords2D(0).begin(), mesh->textureCoords2D(0).end()}), (std::vector<Vector2>{{0.5f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}}));
+
+    /* The view points directly into the data passed to openData() */
+    const char* position = reinterpret_cast<const char*>(&mesh->positions(0)[0]);
+    CORRADE_VERIFY(position > blob.data() && position < blob.data() + blob.size());
+    delete mesh;
+}
+
+void BlobTest::mesh3D() {
+    BlobConverter converter;
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Triangles,
+        new std::vector<UnsignedInt>{0, 1, 2, 2, 1},
+        {new std::vector<Vector3>{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}}},
+        {new std::vector<Vector3>{{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}},
+        {new std::vector<Vector2>{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}}));
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+
+    MeshData3D* mesh = importer.mesh3D(0);
+    CORRADE_COMPARE(mesh->primitive(), Mesh::Primitive::Triangles);
+    CORRADE_COMPARE(*mesh->indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(*mesh->positions(0), (std::vector<Vector3>{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}}));
+    CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+    CORRADE_COMPARE(*mesh->normals(0), (std::vector<Vector3>{{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(*mesh->textureCoords2D(0), (std::vector<Vector2>{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}));
+    delete mesh;
+}
+
+void BlobTest::mesh3DView() {
+    BlobConverter converter;
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Triangles,
+        new std::vector<UnsignedInt>{0, 1, 2, 2, 1},
+        {new std::vector<Vector3>{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}}},
+        {new std::vector<Vector3>{{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}},
+        {new std::vector<Vector2>{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}}));
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}}, {}, {}));
+
+    const std::string filename = "BlobTestView.blob";
+    CORRADE_VERIFY(converter.convertToFile(filename));
+
+    {
+        BlobImporter importer;
+        CORRADE_VERIFY(importer.openFile(filename));
+
+        MeshDataView3D* mesh = importer.mesh3DView(0);
+        CORRADE_VERIFY(mesh->buffer().empty());
+        CORRADE_COMPARE(mesh->primitive(), Mesh::Primitive::Triangles);
+        CORRADE_COMPARE((std::vector<UnsignedInt>{mesh->indices().begin(), mesh->indices().end()}), (std::vector<UnsignedInt>{0, 1, 2, 2, 1}));
+        CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+        CORRADE_COMPARE((std::vector<Vector3>{mesh->positions(0).begin(), mesh->positions(0).end()}), (std::vector<Vector3>{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}}));
+        CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+        CORRADE_COMPARE((std::vector<Vector3>{mesh->normals(0).begin(), mesh->normals(0).end()}), (std::vector<Vector3>{{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}));
+        CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+        CORRADE_COMPARE((std::vector<Vector2>{mesh->textureCoords2D(0).begin(), mesh->textureCoords2D(0).end()}), (std::vector<Vector2>{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}));
+
+        /* Modification changes only the opened data, not the file */
+        mesh->positions(0)[0] = Vector3(-1.0f);
+        delete mesh;
+        MeshData3D* copy = importer.mesh3D(0);
+        CORRADE_COMPARE((*copy->positions(0))[0], Vector3(-1.0f));
+        delete copy;
+
+        MeshDataView3D* points = importer.mesh3DView(1);
+        CORRADE_VERIFY(!points->isIndexed());
+        CORRADE_COMPARE(points->normalArrayCount(), 0);
+        CORRADE_COMPARE(points->positions(0).size(), 1);
+        CORRADE_COMPARE(points->positions(0)[0], Vector3(1.0f, 2.0f, 3.0f));
+        delete points;
+    }
+
+    {
+        BlobImporter importer;
+        CORRADE_VERIFY(importer.openFile(filename));
+        MeshData3D* mesh = importer.mesh3D(0);
+        CORRADE_COMPARE((*mesh->positions(0))[0], Vector3(0.0f, 1.0f, 2.0f));
+        delete mesh;
+    }
+
+    std::remove(filename.data());
+}
+
+void BlobTest::image2D() {
+    unsigned char* data = new unsigned char[6]{'a', 'b', 'c', 'd', 'e', 'f'};
+
+    BlobConverter converter;
+    converter.addImage2D(ImageData2D({3, 2}, AbstractImage::Format::Red, AbstractImage::Type::UnsignedByte, data));
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+    CORRADE_COMPARE(importer.image2DCount(), 1);
+
+    ImageData2D* image = importer.image2D(0);
+    CORRADE_COMPARE(image->size(), Vector2i(3, 2));
+    CORRADE_COMPARE(image->format(), AbstractImage::Format::Red);
+    CORRADE_COMPARE(image->type(), AbstractImage::Type::UnsignedByte);
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 6), "abcdef");
+    delete image;
+}
+
+void BlobTest::image2DView() {
+    unsigned char* data = new unsigned char[6]{'a', 'b', 'c', 'd', 'e', 'f'};
+
+    BlobConverter converter;
+    converter.addImage2D(ImageData2D({3, 2}, AbstractImage::Format::Red, AbstractImage::Type::UnsignedByte, data));
+
+    const std::string filename = "BlobTestImageView.blob";
+    CORRADE_VERIFY(converter.convertToFile(filename));
+
+    {
+        BlobImporter importer;
+        CORRADE_VERIFY(importer.openFile(filename));
+
+        ImageWrapper2D* image = importer.image2DView(0);
+        CORRADE_COMPARE(image->size(), Vector2i(3, 2));
+        CORRADE_COMPARE(image->format(), AbstractImage::Format::Red);
+        CORRADE_COMPARE(image->type(), AbstractImage::Type::UnsignedByte);
+        CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 6), "abcdef");
+        delete image;
+    }
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+
+    /* The wrapper points directly into the data passed to openData() */
+    ImageWrapper2D* image = importer.image2DView(0);
+    const char* pixels = reinterpret_cast<const char*>(image->data());
+    CORRADE_VERIFY(pixels > blob.data() && pixels + 6 <= blob.data() + blob.size());
+    CORRADE_COMPARE(std::string(pixels, 6), "abcdef");
+    delete image;
+
+    std::remove(filename.data());
+}
+
+void BlobTest::unalignedData() {
+    BlobConverter converter;
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}}, {}, {}));
+    const std::vector<char> original = converter.convertToData();
+
+    /* Data not aligned for in-place access are copied */
+    std::vector<char> data(original.size() + 1);
+    std::copy(original.begin(), original.end(), data.begin() + 1);
+    BlobImporter importer;
+    CORRADE_VERIFY(importer.openData(data.data() + 1, original.size()));
+    data.clear();
+
+    MeshDataView3D* mesh = importer.mesh3DView(0);
+    CORRADE_COMPARE(mesh->positions(0).size(), 1);
+    CORRADE_COMPARE(mesh->positions(0)[0], Vector3(1.0f, 2.0f, 3.0f));
+    delete mesh;
+}
+
+void BlobTest::names() {
+    BlobConverter converter;
+    converter.addScene(SceneData({}, {}), "scene");
+    converter.addMesh2D(MeshData2D(Mesh::Primitive::Points, nullptr, {new std::vector<Vector2>}, {}));
+    converter.addMesh2D(MeshData2D(Mesh::Primitive::Points, nullptr, {new std::vector<Vector2>}, {}), "points");
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+    CORRADE_COMPARE(importer.sceneName(0), "scene");
+    CORRADE_COMPARE(importer.sceneForName("scene"), 0);
+    CORRADE_COMPARE(importer.mesh2DName(0), "");
+    CORRADE_COMPARE(importer.mesh2DName(1), "points");
+    CORRADE_COMPARE(importer.mesh2DForName("points"), 1);
+    CORRADE_COMPARE(importer.mesh2DForName("scene"), -1);
+    CORRADE_COMPARE(importer.defaultScene(), -1);
+}
+
+void BlobTest::file() {
+    BlobConverter converter;
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}}, {}, {}), "point");
+
+    const std::string filename = "BlobTest.blob";
+    CORRADE_VERIFY(converter.convertToFile(filename));
+
+    {
+        BlobImporter importer;
+        CORRADE_VERIFY(importer.openFile(filename));
+        CORRADE_COMPARE(importer.mesh3DForName("point"), 0);
+
+        MeshData3D* mesh = importer.mesh3D(0);
+        CORRADE_COMPARE(*mesh->positions(0), (std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}));
+        delete mesh;
+    }
+
+    std::remove(filename.data());
+}
+
+void BlobTest::importer() {
+    BlobConverter original;
+    original.addScene(SceneData({}, {0}), "scene");
+    original.addObject3D(MeshObjectData3D({}, Matrix4(), 0, 2), "object");
+    original.addMesh3D(MeshData3D(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}}, {}, {}), "mesh");
+    original.setDefaultScene(0);
+
+    /* Bake everything from one importer into another blob */
+    std::vector<char> blob;
+    BlobImporter source;
+    CORRADE_VERIFY(open(source, original, blob));
+    BlobConverter converter;
+    CORRADE_VERIFY(converter.addImporter(&source));
+    CORRADE_COMPARE(converter.entryCount(), 3);
+    CORRADE_COMPARE_AS(converter.convertToData(), original.convertToData(), Corrade::TestSuite::Compare::Container);
+}
+
+void BlobTest::invalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BlobImporter importer;
+    CORRADE_VERIFY(!importer.openData("MGB", 3));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: not a Magnum blob\n");
+
+    std::vector<char> data = BlobConverter().convertToData();
+    std::swap(data[6], data[7]);
+    out.str({});
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: unsupported endianness\n");
+
+    BlobConverter converter;
+    converter.addScene(SceneData({}, {}));
+    data = converter.convertToData();
+    data.resize(data.size() - 8);
+    out.str({});
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: invalid entry 0\n");
+    CORRADE_COMPARE(importer.sceneCount(), 0);
+}
+
+void BlobTest::invalidEntry() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BlobConverter converter;
+    converter.addScene(SceneData({}, {}), "scene");
+    const std::vector<char> original = converter.convertToData();
+    BlobImporter importer;
+
+    /* Offset + size wraps around */
+    std::vector<char> data = original;
+    reinterpret_cast<Implementation::BlobEntry*>(data.data() + sizeof(Implementation::BlobHeader))->size = ~UnsignedLong(0);
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: invalid entry 0\n");
+
+    /* Name offset + name size wraps around */
+    data = original;
+    reinterpret_cast<Implementation::BlobEntry*>(data.data() + sizeof(Implementation::BlobHeader))->nameOffset = ~UnsignedLong(0);
+    out.str({});
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: invalid entry 0\n");
+
+    /* Entry count pointing outside of the file */
+    data = original;
+    reinterpret_cast<Implementation::BlobHeader*>(data.data())->entryCount = ~UnsignedInt(0);
+    out.str({});
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: file too short\n");
+}
+
+void BlobTest::invalidEntryValue() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BlobImporter importer;
+
+    /* Unknown primitive */
+    BlobConverter meshConverter;
+    meshConverter.addMesh2D(MeshData2D(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector2>{{1.0f, 2.0f}}}, {}));
+    std::vector<char> data = meshConverter.convertToData();
+    payload<Implementation::BlobMesh>(data).primitive = 0xdead;
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: invalid entry 0\n");
+    CORRADE_COMPARE(importer.mesh2DCount(), 0);
+
+    /* Unknown instance type */
+    BlobConverter objectConverter;
+    objectConverter.addObject3D(ObjectData3D({}, Matrix4()));
+    data = objectConverter.convertToData();
+    payload<Implementation::BlobObject3D>(data).instanceType = 4;
+    out.str({});
+    CORRADE_VERIFY(!importer.openData(data.data(), data.size()));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter: invalid entry 0\n");
+    CORRADE_COMPARE(importer.object3DCount(), 0);
+}
+
+void BlobTest::invalidMesh() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BlobConverter converter;
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Points, new std::vector<UnsignedInt>{0},
+        {new std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}}, {}, {}));
+    std::vector<char> data = converter.convertToData();
+    payload<Implementation::BlobMesh>(data).indexed = 2;
+
+    BlobImporter importer;
+    CORRADE_VERIFY(importer.openData(data.data(), data.size()));
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_VERIFY(!importer.mesh3DView(0));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter::mesh3D(): entry 0 is invalid\n"
+                               "Trade::BlobImporter::mesh3DView(): entry 0 is invalid\n");
+}
+
+void BlobTest::invalidImage() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BlobConverter converter;
+    converter.addImage2D(ImageData2D({3, 2}, AbstractImage::Format::RGB, AbstractImage::Type::UnsignedByte, new unsigned char[18]()));
+    const std::vector<char> original = converter.convertToData();
+    BlobImporter importer;
+
+    /* Negative size */
+    std::vector<char> data = original;
+    payload<Implementation::BlobImage2D>(data).size[0] = -3;
+    payload<Implementation::BlobImage2D>(data).size[1] = -2;
+    CORRADE_VERIFY(importer.openData(data.data(), data.size()));
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter::image2D(): entry 0 is invalid\n");
+
+    /* Data size not matching the image size */
+    data = original;
+    payload<Implementation::BlobImage2D>(data).size[0] = 4;
+    out.str({});
+    CORRADE_VERIFY(importer.openData(data.data(), data.size()));
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter::image2D(): entry 0 is invalid\n");
+
+    /* Unknown pixel type */
+    data = original;
+    payload<Implementation::BlobImage2D>(data).type = 0;
+    out.str({});
+    CORRADE_VERIFY(importer.openData(data.data(), data.size()));
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter::image2D(): entry 0 is invalid\n");
+
+    /* Data size larger than the entry */
+    data = original;
+    payload<Implementation::BlobImage2D>(data).dataSize = ~UnsignedLong(0);
+    out.str({});
+    CORRADE_VERIFY(importer.openData(data.data(), data.size()));
+    CORRADE_VERIFY(!importer.streamImage2D(0, 1024, [](const ImageWrapper2D&, Int) { return true; }));
+    CORRADE_COMPARE(out.str(), "Trade::BlobImporter::streamImage2D(): entry 0 is invalid\n");
+}
+
+void BlobTest::streamMesh3D() {
+    BlobConverter converter;
+    converter.addMesh3D(bigMesh());
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(importer.features() & AbstractImporter::Feature::Streaming);
+    CORRADE_VERIFY(open(importer, converter, blob));
+
+    StreamedMesh streamed;
+    CORRADE_VERIFY(importer.streamMesh3D(0, 1024, std::ref(streamed)));
+
+    /* 1000 vertices of 20 bytes in 1024-byte chunks, 3000 indices in
+       1024-byte chunks */
+    CORRADE_COMPARE(streamed.chunkCount, 20 + 12);
+    CORRADE_VERIFY(streamed.maxChunkSize <= 1024);
+
+    MeshData3D original = bigMesh();
+    CORRADE_COMPARE(streamed.indices, *original.indices());
+    CORRADE_COMPARE(streamed.positions, *original.positions(0));
+    CORRADE_COMPARE(streamed.textureCoords2D, *original.textureCoords2D(0));
+}
+
+void BlobTest::streamMesh3DFile() {
+    BlobConverter converter;
+    converter.addMesh3D(MeshData3D(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}}, {}, {}));
+    converter.addMesh3D(bigMesh());
+
+    const std::string filename = "BlobTestStream.blob";
+    CORRADE_VERIFY(converter.convertToFile(filename));
+
+    {
+        BlobImporter importer;
+        CORRADE_VERIFY(importer.openFile(filename));
+
+        /* Chunk smaller than one vertex still delivers one vertex */
+        StreamedMesh streamed;
+        CORRADE_VERIFY(importer.streamMesh3D(1, 1, std::ref(streamed)));
+        CORRADE_COMPARE(streamed.chunkCount, 1000 + 3000);
+
+        MeshData3D original = bigMesh();
+        CORRADE_COMPARE(streamed.indices, *original.indices());
+        CORRADE_COMPARE(streamed.positions, *original.positions(0));
+        CORRADE_COMPARE(streamed.textureCoords2D, *original.textureCoords2D(0));
+    }
+
+    std::remove(filename.data());
+}
+
+void BlobTest::streamImage2D() {
+    unsigned char* data = new unsigned char[15]{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o'};
+
+    BlobConverter converter;
+    converter.addImage2D(ImageData2D({3, 5}, AbstractImage::Format::Red, AbstractImage::Type::UnsignedByte, data));
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+
+    std::vector<Int> rows;
+    std::string pixels;
+    CORRADE_VERIFY(importer.streamImage2D(0, 7, [&](const ImageWrapper2D& chunk, Int row) {
+        if(chunk.size().x() != 3 || chunk.format() != AbstractImage::Format::Red) return false;
+        rows.push_back(row);
+        pixels.append(reinterpret_cast<const char*>(chunk.data()), chunk.size().product());
+        return true;
+    }));
+
+    /* Two rows in each chunk */
+    CORRADE_COMPARE(rows, (std::vector<Int>{0, 2, 4}));
+    CORRADE_COMPARE(pixels, "abcdefghijklmno");
+}
+
+void BlobTest::streamAbort() {
+    BlobConverter converter;
+    converter.addMesh3D(bigMesh());
+
+    std::vector<char> blob;
+    BlobImporter importer;
+    CORRADE_VERIFY(open(importer, converter, blob));
+
+    std::size_t chunkCount = 0;
+    CORRADE_VERIFY(!importer.streamMesh3D(0, 1024, [&](const MeshDataView3D&, std::size_t) {
+        return ++chunkCount != 3;
+    }));
+    CORRADE_COMPARE(chunkCount, 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BlobTest)
@@ -0,0 +1,182 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <TestSuite/Tester.h>
+
+#include "Math/Vector3.h"
+#include "Trade/MeshData2D.h"
+#include "Trade/MeshData3D.h"
+#include "Trade/MeshDataView2D.h"
+#include "Trade/MeshDataView3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshDataViewTest: public Corrade::TestSuite::Tester {
+    public:
+        MeshDataViewTest();
+
+        void constructExternal();
+        void constructFromMeshData2D();
+        void constructFromMeshData3D();
+        void constructNonIndexed();
+        void move();
+        void toMeshData();
+};
+
+MeshDataViewTest::MeshDataViewTest() {
+    addTests({&MeshDataViewTest::constructExternal,
+              &MeshDataViewTest::constructFromMeshData2D,
+              &MeshDataViewTest::constructFromMeshData3D,
+              &MeshDataViewTest::constructNonIndexed,
+              &MeshDataViewTest::move,
+              &MeshDataViewTest::toMeshData});
+}
+
+namespace {
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoords;
+    };
+
+    MeshData3D meshData3D() {
+        return MeshData3D(Mesh::Primitive::Triangles,
+            new std::vector<UnsignedInt>{0, 1, 2},
+            {new std::vector<Vector3>{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}},
+            {new std::vector<Vector3>{{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}}},
+            {new std::vector<Vector2>{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}},
+             new std::vector<Vector2>{{0.5f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}}});
+    }
+}
+
+void MeshDataViewTest::constructExternal() {
+    /* Interleaved buffer, no copy is made */
+    std::vector<Vertex> vertices{
+        {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+        {{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+        {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}}};
+    std::vector<UnsignedInt> indices{2, 1, 0};
+    MeshDataView3D data(Mesh::Primitive::Triangles, indices,
+        {StridedArrayView<Vector3>(&vertices[0].position, vertices.size(), sizeof(Vertex))},
+        {StridedArrayView<Vector3>(&vertices[0].normal, vertices.size(), sizeof(Vertex))},
+        {StridedArrayView<Vector2>(&vertices[0].textureCoords, vertices.size(), sizeof(Vertex))});
+
+    CORRADE_VERIFY(data.primitive() == Mesh::Primitive::Triangles);
+    CORRADE_VERIFY(data.buffer().empty());
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_VERIFY(data.indices().data() == indices.data());
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.normalArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 1);
+    CORRADE_VERIFY(data.positions(0).data() == &vertices[0].position);
+    CORRADE_COMPARE(data.positions(0).stride(), sizeof(Vertex));
+    CORRADE_COMPARE(data.normals(0)[2], Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(data.textureCoords2D(0)[1], Vector2(1.0f, 0.0f));
+
+    /* Modifying through the view modifies the original */
+    data.positions(0)[1] = {3.0f, 4.0f, 5.0f};
+    CORRADE_COMPARE(vertices[1].position, Vector3(3.0f, 4.0f, 5.0f));
+}
+
+void MeshDataViewTest::constructFromMeshData2D() {
+    MeshData2D original(Mesh::Primitive::LineLoop,
+        new std::vector<UnsignedInt>{0, 1, 2, 1},
+        {new std::vector<Vector2>{{1.0f, 0.0f}, {0.0f, 1.0f}, {-1.0f, 0.0f}}},
+        {new std::vector<Vector2>{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}});
+    const MeshDataView2D data(original);
+
+    CORRADE_VERIFY(data.primitive() == Mesh::Primitive::LineLoop);
+    CORRADE_COMPARE(data.buffer().size(), 4*4 + 3*8 + 3*8);
+    CORRADE_COMPARE(data.indices().toVector(), (std::vector<UnsignedInt>{0, 1, 2, 1}));
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.positions(0).toVector(), *original.positions(0));
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2D(0).toVector(), *original.textureCoords2D(0));
+}
+
+void MeshDataViewTest::constructFromMeshData3D() {
+    MeshData3D original = meshData3D();
+    const MeshDataView3D data(original);
+
+    /* Everything is in one buffer */
+    CORRADE_COMPARE(data.buffer().size(), 3*4 + 3*12 + 3*12 + 2*3*8);
+    const char* begin = data.buffer().data();
+    const char* end = begin + data.buffer().size();
+    CORRADE_VERIFY(reinterpret_cast<const char*>(data.indices().data()) == begin);
+    CORRADE_VERIFY(reinterpret_cast<const char*>(data.textureCoords2D(1).data() + 3) == end);
+
+    CORRADE_COMPARE(data.indices().toVector(), *original.indices());
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.positions(0).toVector(), *original.positions(0));
+    CORRADE_COMPARE(data.normalArrayCount(), 1);
+    CORRADE_COMPARE(data.normals(0).toVector(), *original.normals(0));
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 2);
+    CORRADE_COMPARE(data.textureCoords2D(0).toVector(), *original.textureCoords2D(0));
+    CORRADE_COMPARE(data.textureCoords2D(1).toVector(), *original.textureCoords2D(1));
+}
+
+void MeshDataViewTest::constructNonIndexed() {
+    MeshData3D original(Mesh::Primitive::Points, nullptr,
+        {new std::vector<Vector3>{{1.0f, 0.0f, 0.0f}}}, {}, {});
+    const MeshDataView3D data(original);
+
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_VERIFY(data.indices().empty());
+    CORRADE_COMPARE(data.positions(0)[0], Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(data.normalArrayCount(), 0);
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 0);
+}
+
+void MeshDataViewTest::move() {
+    MeshDataView3D a(meshData3D());
+    const Vector3* positions = a.positions(0).data();
+
+    /* The views stay valid as the buffer is moved, not copied */
+    MeshDataView3D b(std::move(a));
+    CORRADE_VERIFY(b.positions(0).data() == positions);
+    CORRADE_COMPARE(b.positions(0)[2], Vector3(0.0f, 0.0f, 1.0f));
+
+    MeshDataView3D c(MeshData3D(Mesh::Primitive::Points, nullptr, {new std::vector<Vector3>}, {}, {}));
+    c = std::move(b);
+    CORRADE_VERIFY(c.positions(0).data() == positions);
+    CORRADE_COMPARE(c.textureCoords2DArrayCount(), 2);
+}
+
+void MeshDataViewTest::toMeshData() {
+    const MeshDataView3D view(meshData3D());
+    MeshData3D data = view.toMeshData();
+
+    CORRADE_VERIFY(data.primitive() == Mesh::Primitive::Triangles);
+    CORRADE_VERIFY(data.indices());
+    CORRADE_COMPARE(*data.indices(), (std::vector<UnsignedInt>{0, 1, 2}));
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(*data.positions(0), view.positions(0).toVector());
+    CORRADE_COMPARE(data.normalArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 2);
+    CORRADE_COMPARE(*data.textureCoords2D(1), view.textureCoords2D(1).toVector());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshDataViewTest)
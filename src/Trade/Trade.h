@@ -47,6 +47,8 @@ typedef ImageData<3> ImageData3D;
 class LightData;
 class MeshData2D;
 class MeshData3D;
+class MeshDataView2D;
+class MeshDataView3D;
 class MeshObjectData2D;
 class MeshObjectData3D;
 class ObjectData2D;